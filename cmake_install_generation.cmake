@@ -6,6 +6,10 @@ add_library(sciplot INTERFACE)
 # Set sciplot compilation features to be propagated to client code.
 target_compile_features(sciplot INTERFACE cxx_std_17)
 
+# Link against the platform thread library, used to process large data sets in parallel.
+find_package(Threads REQUIRED)
+target_link_libraries(sciplot INTERFACE Threads::Threads)
+
 target_include_directories(sciplot INTERFACE
         $<BUILD_INTERFACE:${PROJECT_SOURCE_DIR}>
         $<INSTALL_INTERFACE:${CMAKE_INSTALL_INCLUDEDIR}>
@@ -0,0 +1,68 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create a 2000 x 2000 scalar field with two peaks and a valley
+    const std::size_t n = 2000;
+    std::vector<double> field(n * n);
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto x = -3.0 + 6.0 * i / (n - 1);
+            const auto y = -3.0 + 6.0 * j / (n - 1);
+            field[j * n + i] = std::exp(-(x - 1.0) * (x - 1.0) - y * y) + 0.8 * std::exp(-(x + 1.2) * (x + 1.2) - (y - 1.0) * (y - 1.0)) - 0.6 * std::exp(-0.5 * x * x - (y + 1.5) * (y + 1.5));
+        }
+    }
+
+    // Create a Plot object
+    Plot2D plot;
+    plot.xlabel("x");
+    plot.ylabel("y");
+    plot.legend().hide();
+
+    // Draw the contours traced natively, every level with its own palette color
+    plot.drawContours(MatrixView(field, n), -3.0, 3.0, -3.0, 3.0, {-0.5, -0.3, -0.1, 0.1, 0.3, 0.5, 0.7, 0.9});
+
+    // Create figure to hold plot
+    Figure fig = {{plot}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-contours.pdf");
+}
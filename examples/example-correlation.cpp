@@ -0,0 +1,73 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <random>
+#include <string>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create 40 metrics of 100000 samples driven by four shared factors
+    std::mt19937 generator(42);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    const std::size_t nummetrics = 40;
+    const std::size_t numsamples = 100000;
+    std::vector<std::vector<double>> factors(4, std::vector<double>(numsamples));
+    for (auto& factor : factors)
+        for (auto& value : factor)
+            value = normal(generator);
+    std::vector<std::vector<double>> metrics(nummetrics, std::vector<double>(numsamples));
+    std::vector<std::string> names(nummetrics);
+    for (std::size_t m = 0; m < nummetrics; ++m)
+    {
+        names[m] = "m" + std::to_string(m);
+        for (std::size_t i = 0; i < numsamples; ++i)
+            metrics[m][i] = factors[m % 4][i] + 0.1 * m * normal(generator);
+    }
+
+    // Create a Plot object
+    Plot2D plot;
+    plot.palette("rdbu");
+    plot.legend().hide();
+
+    // Draw the correlation matrix of the metrics, computed natively, with their names along both axes
+    plot.drawCorrelationMatrix(metrics, names);
+
+    // Create figure to hold plot
+    Figure fig = {{plot}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+    canvas.size(800, 800);
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-correlation.pdf");
+}
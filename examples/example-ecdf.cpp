@@ -0,0 +1,67 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <random>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create one million heavy-tailed request latencies (in milliseconds)
+    std::mt19937 generator(42);
+    std::lognormal_distribution<double> distribution(1.0, 0.8);
+    std::vector<double> latencies(1000000);
+    for (auto& latency : latencies)
+        latency = distribution(generator);
+
+    // Create a Plot object showing the cumulative distribution
+    Plot2D cdf;
+    cdf.xlabel("latency (ms)");
+    cdf.ylabel("P(X ≤ x)");
+    cdf.drawECDF(latencies).label("ECDF");
+
+    // Create a Plot object showing the tail on log-log axes
+    Plot2D tail;
+    tail.xlabel("latency (ms)");
+    tail.ylabel("P(X ≥ x)");
+    tail.xtics().logscale();
+    tail.ytics().logscale();
+    tail.drawCCDF(latencies).label("CCDF");
+
+    // Create figure to hold plots
+    Figure fig = {{cdf, tail}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+    canvas.size(1200, 500);
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-ecdf.pdf");
+}
@@ -0,0 +1,72 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <random>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create an ensemble of 200 random walks of 10000 steps, stored run after run
+    const std::size_t numruns = 200;
+    const std::size_t numsteps = 10000;
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution(0.0, 1.0);
+    std::vector<double> x(numsteps);
+    std::vector<double> runs(numruns * numsteps);
+    for (std::size_t s = 0; s < numsteps; ++s)
+        x[s] = static_cast<double>(s);
+    for (std::size_t r = 0; r < numruns; ++r)
+    {
+        auto value = 0.0;
+        for (std::size_t s = 0; s < numsteps; ++s)
+            runs[r * numsteps + s] = value += distribution(generator);
+    }
+
+    // Create a Plot object
+    Plot2D plot;
+
+    // Set the x and y labels
+    plot.xlabel("step");
+    plot.ylabel("value");
+
+    // Draw the median over the 5-95 and 25-75 percentile bands, computed natively for every step
+    plot.drawEnsemble(x, runs, numruns, MatrixLayout::rowmajor, {5.0, 25.0, 75.0, 95.0})
+        .label("median");
+
+    // Create figure to hold plot
+    Figure fig = {{plot}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-ensemble.pdf");
+}
@@ -0,0 +1,74 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <iostream>
+#include <random>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create one million noisy points along a parabola
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> uniform(0.0, 10.0);
+    std::normal_distribution<double> noise(0.0, 2.0);
+    std::vector<double> x(1000000);
+    std::vector<double> y(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = uniform(generator);
+        y[i] = 1.0 + 0.5 * x[i] + 0.2 * x[i] * x[i] + noise(generator);
+    }
+
+    // Fit a quadratic natively, reading the points once
+    const Fit fit(x, y, FitModel::polynomial(2));
+    const auto coeffs = fit.coefficients();
+    std::cout << "y = " << coeffs[0] << " + " << coeffs[1] << " x + " << coeffs[2] << " x^2" << std::endl;
+
+    // Create a Plot object
+    Plot2D plot;
+
+    // Set the x and y labels
+    plot.xlabel("x");
+    plot.ylabel("y");
+
+    // Draw the 99% confidence band and the fitted curve, without writing the points
+    plot.drawFitConfidenceBand(fit, 0.99).fillTransparent().fillIntensity(0.3).label("99% confidence");
+    plot.drawFit(fit).label("quadratic fit");
+
+    // Create figure to hold plot
+    Figure fig = {{plot}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-fit.pdf");
+}
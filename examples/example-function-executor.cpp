@@ -0,0 +1,83 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cmath>
+#include <future>
+#include <iostream>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+// An expensive function of one variable: the fixed point of y = cos(x y), found by many small iterations
+auto solve(double x) -> double
+{
+    auto y = 0.0;
+    for (auto i = 0; i < 100000; ++i)
+        y = std::cos(x * y);
+    return y;
+}
+
+int main(int argc, char** argv)
+{
+    // An executor submitting every evaluation as an asynchronous task (a thread pool could be used the same way)
+    const Executor async = [](std::size_t size, const std::function<void(std::size_t)>& task) {
+        std::vector<std::future<void>> futures;
+        for (std::size_t i = 0; i < size; ++i)
+            futures.push_back(std::async(std::launch::async, task, i));
+        for (auto& future : futures)
+            future.get();
+    };
+
+    // Draw the expensive function, sampled adaptively with every round of points evaluated by the executor
+    Plot2D plot;
+    plot.xlabel("x");
+    plot.ylabel("y");
+    plot.drawFunction(solve, 0.0, 2.0, async).label("fixed point of y = cos(xy)");
+
+    // Draw a function of two variables sampled on a grid, evaluated on as many threads as worthwhile
+    Plot3D surface;
+    surface.drawFunction([](double x, double y) { return std::sin(x) * std::cos(y) * solve(0.1 * x); }, -3.0, 3.0, -3.0, 3.0, 40).label("surface");
+
+    // Print how many evaluations were needed and how long they took
+    for (const auto& draw : plot.renderStats().draws)
+        std::cout << draw.evaluations << " evaluations in " << draw.evaluationseconds << " s, " << draw.rowsout << " rows written" << std::endl;
+    for (const auto& draw : surface.renderStats().draws)
+        std::cout << draw.evaluations << " evaluations in " << draw.evaluationseconds << " s" << std::endl;
+
+    // Create figure to hold plots
+    Figure fig = {{plot, surface}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+    canvas.size(1200, 500);
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-function-executor.pdf");
+}
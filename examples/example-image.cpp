@@ -0,0 +1,92 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create a 4096 x 4096 detector frame with a few Gaussian spots on a ripple background
+    const std::size_t n = 4096;
+    std::vector<double> frame(n * n);
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto x = i / double(n);
+            const auto y = j / double(n);
+            auto value = 0.1 * std::sin(40.0 * x) * std::cos(30.0 * y);
+            value += std::exp(-((x - 0.3) * (x - 0.3) + (y - 0.6) * (y - 0.6)) / 0.002);
+            value += 0.5 * std::exp(-((x - 0.7) * (x - 0.7) + (y - 0.2) * (y - 0.2)) / 0.0005);
+            frame[j * n + i] = value;
+        }
+    }
+
+    // Create an interleaved RGB image of 1024 x 1024 pixels (three bytes per pixel, converted to doubles)
+    const std::size_t m = 1024;
+    std::vector<double> pixels(m * m * 3);
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        for (std::size_t i = 0; i < m; ++i)
+        {
+            pixels[(j * m + i) * 3 + 0] = static_cast<std::uint8_t>(255.0 * i / m);
+            pixels[(j * m + i) * 3 + 1] = static_cast<std::uint8_t>(255.0 * j / m);
+            pixels[(j * m + i) * 3 + 2] = static_cast<std::uint8_t>(128.0 + 127.0 * std::sin(0.02 * (i + j)));
+        }
+    }
+
+    // Create a Plot object with the frame, reduced to the resolution the plot has on the canvas by keeping the brightest value of every pixel
+    Plot2D detector;
+    detector.resolution(600, 500);
+    detector.xlabel("x (mm)");
+    detector.ylabel("y (mm)");
+    detector.legend().hide();
+    detector.drawImage(MatrixView(frame, n), 0.0, 40.0, 0.0, 40.0, Pooling::max);
+
+    // Create a Plot object with the RGB image, viewing every channel of the interleaved buffer with a column stride of 3 and averaging the pixels of every plot pixel
+    Plot2D photo;
+    photo.resolution(600, 500);
+    photo.legend().hide();
+    const auto channel = [&](std::size_t c) { return MatrixView(pixels.data() + c, m, m, 3 * m, 3); };
+    photo.drawRGBImage(channel(0), channel(1), channel(2), 0.0, 1.0, 0.0, 1.0, Pooling::mean);
+
+    // Create figure to hold plots
+    Figure fig = {{detector, photo}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+    canvas.size(1200, 500);
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-image.pdf");
+}
@@ -0,0 +1,71 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create a 128 x 128 x 128 volume sampling the field of two overlapping blobs
+    const std::size_t n = 128;
+    const auto grid = linspace(-2.0, 2.0, n - 1);
+    std::vector<double> volume(n * n * n);
+    for (std::size_t k = 0; k < n; ++k)
+        for (std::size_t j = 0; j < n; ++j)
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const auto x = grid[i], y = grid[j], z = grid[k];
+                volume[(k * n + j) * n + i] = std::exp(-((x - 0.6) * (x - 0.6) + y * y + z * z)) + std::exp(-((x + 0.6) * (x + 0.6) + y * y + 2.0 * z * z));
+            }
+
+    // Create a Plot3D object
+    Plot3D plot;
+    plot.xlabel("x");
+    plot.ylabel("y");
+    plot.zlabel("z");
+    plot.legend().hide();
+
+    // Draw the farthest triangles first
+    plot.gnuplot("set pm3d depthorder");
+
+    // Draw the isosurface extracted natively with marching cubes
+    plot.drawIsosurface(grid, grid, grid, VolumeView(volume, n, n), 0.5).fillColor("steelblue");
+
+    // Create figure to hold plot
+    Figure fig = {{plot}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-isosurface.pdf");
+}
@@ -0,0 +1,86 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create a terrain of 1000 x 1000 vertices, two triangles per grid cell, with gentle slopes and a few sharp ridges
+    const std::size_t n = 1000;
+    std::vector<double> x, y, z;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto u = 10.0 * i / (n - 1);
+            const auto v = 10.0 * j / (n - 1);
+            x.push_back(u);
+            y.push_back(v);
+            z.push_back(0.3 * std::sin(0.5 * u) * std::cos(0.4 * v) + 0.5 * std::exp(-std::abs(u - v - 2.0) * 4.0));
+        }
+    }
+    std::vector<std::size_t> triangles;
+    for (std::size_t j = 0; j + 1 < n; ++j)
+    {
+        for (std::size_t i = 0; i + 1 < n; ++i)
+        {
+            const auto k = j * n + i;
+            triangles.insert(triangles.end(), {k, k + 1, k + n + 1, k, k + n + 1, k + n});
+        }
+    }
+
+    // Create a Plot3D object
+    Plot3D plot;
+    plot.xlabel("x (km)");
+    plot.ylabel("y (km)");
+    plot.zlabel("height (km)");
+    plot.legend().hide();
+    plot.gnuplot("set pm3d depthorder");
+
+    // Draw the terrain simplified down to at most 20000 triangles
+    plot.drawMesh(x, y, z, triangles, MeshDecimation::faces(20000)).fillColor("sienna");
+
+    // Report how far the mesh was simplified and how long it took
+    for (const auto& draw : plot.renderStats().draws)
+        std::cout << draw.facesin << " triangles decimated to " << draw.facesout << " in " << draw.decimationseconds << " s" << std::endl;
+
+    // Create figure to hold plot
+    Figure fig = {{plot}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-mesh.pdf");
+}
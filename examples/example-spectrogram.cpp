@@ -0,0 +1,72 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cmath>
+#include <random>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create a 60 s vibration signal sampled at 10 kHz: a chirp from 100 Hz to 2 kHz, a steady 3 kHz tone and noise
+    const auto fs = 10000.0;
+    std::mt19937 generator(42);
+    std::normal_distribution<double> noise(0.0, 0.5);
+    std::vector<double> signal(600000);
+    for (std::size_t i = 0; i < signal.size(); ++i)
+    {
+        const auto t = i / fs;
+        signal[i] = std::sin(2.0 * PI * (100.0 * t + 1900.0 / 120.0 * t * t)) + 0.3 * std::sin(2.0 * PI * 3000.0 * t) + noise(generator);
+    }
+
+    // Create a Plot object with the power spectrum of the whole signal
+    Plot2D spectrum;
+    spectrum.xlabel("frequency (Hz)");
+    spectrum.ylabel("PSD (1/Hz)");
+    spectrum.ytics().logscale();
+    spectrum.drawPowerSpectrum(signal, fs, 4096).label("Welch");
+
+    // Create a Plot object with the spectrogram of the signal
+    Plot2D spectrogram;
+    spectrogram.xlabel("time (s)");
+    spectrogram.ylabel("frequency (Hz)");
+    spectrogram.legend().hide();
+    spectrogram.drawSpectrogram(signal, fs, 1024, 256);
+
+    // Create figure to hold plots
+    Figure fig = {{spectrum, spectrogram}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+    canvas.size(1200, 500);
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-spectrogram.pdf");
+}
@@ -0,0 +1,82 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+int main(int argc, char** argv)
+{
+    // Create the heights of a 400 x 300 grid, stored row after row
+    const std::size_t nx = 400;
+    const std::size_t ny = 300;
+    std::vector<double> heights(nx * ny);
+    for (std::size_t j = 0; j < ny; ++j)
+    {
+        for (std::size_t i = 0; i < nx; ++i)
+        {
+            const auto x = -3.0 + 6.0 * i / (nx - 1);
+            const auto y = -3.0 + 6.0 * j / (ny - 1);
+            heights[j * nx + i] = std::exp(-x * x - y * y) * std::cos(3.0 * x) * std::sin(2.0 * y);
+        }
+    }
+
+    // Create a Plot object with the whole grid as a surface colored by height
+    Plot3D surface;
+    surface.xlabel("x");
+    surface.ylabel("y");
+    surface.zlabel("z");
+    surface.palette("jet");
+    surface.drawSurface(MatrixView(heights, ny), -3.0, 3.0, -3.0, 3.0).label("surface");
+
+    // Create a Plot object with every tenth node of the grid as a mesh, viewed through strides without copying
+    Plot3D mesh;
+    mesh.xlabel("x");
+    mesh.ylabel("y");
+    mesh.zlabel("z");
+    const MatrixView coarse(heights.data(), ny / 10, nx / 10, 10 * nx, 10);
+    std::vector<double> x(coarse.cols()), y(coarse.rows());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = -3.0 + 6.0 * (10 * i) / (nx - 1);
+    for (std::size_t j = 0; j < y.size(); ++j)
+        y[j] = -3.0 + 6.0 * (10 * j) / (ny - 1);
+    mesh.drawSurfaceMesh(x, y, coarse).label("mesh");
+
+    // Create figure to hold plots
+    Figure fig = {{surface, mesh}};
+    // Create canvas to hold figure
+    Canvas canvas = {{fig}};
+    canvas.size(1200, 500);
+
+    // Show the plot in a pop-up window
+    canvas.show();
+
+    // Save the plot to a PDF file
+    canvas.save("example-surface.pdf");
+}
@@ -26,6 +26,7 @@
 #pragma once
 
 // C++ includes
+#include <chrono>
 #include <variant>
 #include <vector>
 
@@ -58,6 +59,7 @@ class Canvas
     auto defaultPalette(const std::string& name) -> Canvas&;
 
     /// Set the output size of the canvas (in unit of points, with 1 inch = 72 points).
+    /// Plots drawn from large vectors should be given the same size with @ref Plot::resolution before drawing, so that their data is reduced to this output.
     auto size(std::size_t width, std::size_t height) -> Canvas&;
 
     /// Set the font name for all the plots on the canvas (e.g., Helvetica, Georgia, Times).
@@ -75,6 +77,7 @@ class Canvas
 
     /// Show the canvas in a pop-up window.
     /// @note This method removes temporary files after saving if `Canvas::autoclean(true)` (default).
+    /// @note The time gnuplot takes is recorded in renderStats(), but only save() uses it to refine the estimated gnuplot throughput, since here it includes opening the window.
     auto show() const -> void;
 
     /// Save the canvas to a file, with its extension defining the file format.
@@ -87,6 +90,9 @@ class Canvas
     /// Delete all files used to store plot data or scripts.
     auto cleanup() const -> void;
 
+    /// Return the statistics recorded for the draw calls of all figures and the time gnuplot took to render the last saved or shown canvas.
+    auto renderStats() const -> RenderStats;
+
   private:
     /// Counter of how many canvas objects have been instanciated in the application
     static std::size_t m_counter;
@@ -124,6 +130,9 @@ class Canvas
 
     /// All the figures that have been added to the canvas
     std::vector<std::vector<Figure>> m_figures;
+
+    /// The time spent by gnuplot rendering the last saved or shown canvas
+    mutable double m_gnuplotseconds = 0.0;
 };
 
 // Initialize the counter of plot objects
@@ -227,8 +236,10 @@ inline auto Canvas::show() const -> void
     script.close();
     // save plot data to file(s)
     saveplotdata();
-    // Show the figure
+    // Show the figure, without refining the estimated gnuplot throughput as the time includes opening the window
+    const auto start = std::chrono::steady_clock::now();
     gnuplot::runscript(m_scriptfilename, true);
+    m_gnuplotseconds = internal::secondssince(start);
     // remove the temporary files if user wants to
     if (m_autoclean)
     {
@@ -270,8 +281,12 @@ inline auto Canvas::save(const std::string& filename) const -> void
     script.close();
     // save plot data to file(s)
     saveplotdata();
-    // Save the figure as a file
-    gnuplot::runscript(m_scriptfilename, false);
+    // Save the figure as a file and refine the estimated gnuplot throughput
+    const auto start = std::chrono::steady_clock::now();
+    const auto success = gnuplot::runscript(m_scriptfilename, false);
+    m_gnuplotseconds = internal::secondssince(start);
+    if (success)
+        internal::calibrate(internal::throughput().gnuplot, renderStats().rowsout(), m_gnuplotseconds);
     // remove the temporary files if user wants to
     if (m_autoclean)
     {
@@ -279,6 +294,21 @@ inline auto Canvas::save(const std::string& filename) const -> void
     }
 }
 
+inline auto Canvas::renderStats() const -> RenderStats
+{
+    RenderStats stats;
+    for (const auto& row : m_figures)
+    {
+        for (const auto& figure : row)
+        {
+            const auto figurestats = figure.renderStats();
+            stats.draws.insert(stats.draws.end(), figurestats.draws.begin(), figurestats.draws.end());
+        }
+    }
+    stats.gnuplotseconds = m_gnuplotseconds;
+    return stats;
+}
+
 inline auto Canvas::cleanup() const -> void
 {
     std::remove(m_scriptfilename.c_str());
@@ -0,0 +1,205 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Parallel.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The number of rows of grid cells traced together as one tile, the unit of work shared among threads.
+const auto CONTOUR_TILE_ROWS = 64;
+
+/// The isolines of a scalar field at one level, as polylines stored one after the other.
+struct Isolines
+{
+    std::vector<double> x;              ///< The x coordinates of the vertices of all polylines
+    std::vector<double> y;              ///< The y coordinates of the vertices of all polylines
+    std::vector<std::size_t> blockends; ///< The index one past the last vertex of every polyline (closed polylines end at their first vertex)
+};
+
+/// A piece of isoline crossing a grid cell, joining the points where the level crosses two of its edges.
+/// The edges of a grid of nx by ny nodes are numbered with the horizontal edge from node (j, i) to node (j, i + 1) first, at j * (nx - 1) + i,
+/// followed by the vertical edge from node (j, i) to node (j + 1, i), at ny * (nx - 1) + j * nx + i.
+struct IsoSegment
+{
+    std::size_t a; ///< The index of the first edge crossed
+    std::size_t b; ///< The index of the second edge crossed
+};
+
+/// The pairs of cell edges (0 bottom, 1 right, 2 top, 3 left) joined by isoline segments for every configuration of the cell corners at or above the level,
+/// with bit 0 for the bottom left corner, bit 1 for the bottom right, bit 2 for the top right, and bit 3 for the top left. The two saddles (5 and 10) are listed
+/// as they are resolved when the center of the cell is below the level, and with the pairs of the other saddle otherwise.
+const int MARCHING_SQUARES_SEGMENTS[16][4] = {
+    {-1, -1, -1, -1}, {3, 0, -1, -1}, {0, 1, -1, -1}, {3, 1, -1, -1},
+    {1, 2, -1, -1}, {3, 0, 1, 2}, {0, 2, -1, -1}, {3, 2, -1, -1},
+    {2, 3, -1, -1}, {0, 2, -1, -1}, {0, 1, 2, 3}, {1, 2, -1, -1},
+    {1, 3, -1, -1}, {0, 1, -1, -1}, {3, 0, -1, -1}, {-1, -1, -1, -1}};
+
+/// Append to @p segments the isoline segments at @p level crossing the cells between node rows @p jbegin and @p jend of the grid of @p nx by @p ny nodes with values `valueat(j, i)`.
+/// Cells with a non-finite corner are skipped, which breaks the isolines around missing values.
+template <typename ValueFn>
+auto marchingsquares(const ValueFn& valueat, std::size_t nx, std::size_t ny, double level, std::size_t jbegin, std::size_t jend, std::vector<IsoSegment>& segments) -> void
+{
+    const auto numhorizontal = ny * (nx - 1);
+    for (auto j = jbegin; j < jend; ++j)
+    {
+        for (std::size_t i = 0; i + 1 < nx; ++i)
+        {
+            const double corners[4] = {valueat(j, i), valueat(j, i + 1), valueat(j + 1, i + 1), valueat(j + 1, i)};
+            if (!(std::isfinite(corners[0]) && std::isfinite(corners[1]) && std::isfinite(corners[2]) && std::isfinite(corners[3])))
+                continue;
+            int config = 0;
+            for (int k = 0; k < 4; ++k)
+                config |= (corners[k] >= level) << k;
+            if (config == 0 || config == 15)
+                continue;
+            const std::size_t edges[4] = {j * (nx - 1) + i, numhorizontal + j * nx + i + 1, (j + 1) * (nx - 1) + i, numhorizontal + j * nx + i};
+            const auto saddle = config == 5 || config == 10;
+            const auto center = 0.25 * (corners[0] + corners[1] + corners[2] + corners[3]);
+            const auto& pairs = MARCHING_SQUARES_SEGMENTS[saddle && center >= level ? 15 - config : config];
+            for (int k = 0; k < 4 && pairs[k] >= 0; k += 2)
+                segments.push_back({edges[pairs[k]], edges[pairs[k + 1]]});
+        }
+    }
+}
+
+/// Join the given isoline @p segments into polylines, with `pointat(edge)` the point where the level crosses the given edge.
+/// Every crossed edge is shared by at most two segments (of the two cells on either side of it), so chains are followed through the edges they share:
+/// open polylines start at the edges crossed once (on the border of the grid or of missing values), and the remaining segments form closed loops.
+template <typename PointFn>
+auto stitchsegments(const std::vector<IsoSegment>& segments, const PointFn& pointat) -> Isolines
+{
+    const auto none = std::numeric_limits<std::size_t>::max();
+    const auto numsegments = segments.size();
+
+    // Pair every segment end (2 * segment + side) with the other segment end at the same edge, if any
+    std::vector<std::pair<std::size_t, std::size_t>> ends(2 * numsegments);
+    for (std::size_t s = 0; s < numsegments; ++s)
+    {
+        ends[2 * s] = {segments[s].a, 2 * s};
+        ends[2 * s + 1] = {segments[s].b, 2 * s + 1};
+    }
+    std::sort(ends.begin(), ends.end());
+    std::vector<std::size_t> partner(2 * numsegments, none);
+    for (std::size_t k = 0; k + 1 < ends.size(); ++k)
+    {
+        if (ends[k].first == ends[k + 1].first)
+        {
+            partner[ends[k].second] = ends[k + 1].second;
+            partner[ends[k + 1].second] = ends[k].second;
+        }
+    }
+
+    Isolines lines;
+    std::vector<char> visited(numsegments, 0);
+    const auto edgeat = [&](std::size_t end) { return end % 2 ? segments[end / 2].b : segments[end / 2].a; };
+    const auto follow = [&](std::size_t end) {
+        const auto [x0, y0] = pointat(edgeat(end));
+        lines.x.push_back(x0);
+        lines.y.push_back(y0);
+        while (end != none && !visited[end / 2])
+        {
+            visited[end / 2] = 1;
+            const auto [x, y] = pointat(edgeat(end ^ 1));
+            lines.x.push_back(x);
+            lines.y.push_back(y);
+            end = partner[end ^ 1];
+        }
+        lines.blockends.push_back(lines.x.size());
+    };
+    for (std::size_t end = 0; end < 2 * numsegments; ++end)
+        if (partner[end] == none && !visited[end / 2])
+            follow(end);
+    for (std::size_t s = 0; s < numsegments; ++s)
+        if (!visited[s])
+            follow(2 * s);
+    return lines;
+}
+
+/// Return the isolines at every one of the given @p levels of the field with values `valueat(j, i)` at the nodes (@p x[i], @p y[j]) of a grid of @p nx by @p ny nodes.
+/// The cells are traced with marching squares, resolving saddles by the mean of their corners and placing every crossing by linear interpolation along its edge.
+/// Tiles of @ref CONTOUR_TILE_ROWS rows of cells are traced in parallel for all levels at once, and the segments of every level are then stitched into polylines in parallel.
+template <typename X, typename Y, typename ValueFn>
+auto isolines(const X& x, const Y& y, std::size_t nx, std::size_t ny, const ValueFn& valueat, const std::vector<double>& levels) -> std::vector<Isolines>
+{
+    const auto numlevels = levels.size();
+    std::vector<Isolines> result(numlevels);
+    if (nx < 2 || ny < 2 || numlevels == 0)
+        return result;
+
+    const auto numtiles = (ny - 1 + CONTOUR_TILE_ROWS - 1) / CONTOUR_TILE_ROWS;
+    const auto numtasks = numlevels * numtiles;
+    std::vector<std::vector<IsoSegment>> tilesegments(numtasks);
+    parallelfor(numtasks, std::min(numthreads(nx * ny * numlevels), numtasks), [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (auto task = begin; task < end; ++task)
+        {
+            const auto tile = task % numtiles;
+            const auto jbegin = tile * CONTOUR_TILE_ROWS;
+            const auto jend = std::min<std::size_t>(jbegin + CONTOUR_TILE_ROWS, ny - 1);
+            marchingsquares(valueat, nx, ny, levels[task / numtiles], jbegin, jend, tilesegments[task]);
+        }
+    });
+
+    const auto numhorizontal = ny * (nx - 1);
+    parallelfor(numlevels, std::min(numthreads(nx * ny * numlevels), numlevels), [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (auto l = begin; l < end; ++l)
+        {
+            const auto level = levels[l];
+            std::vector<IsoSegment> segments;
+            for (std::size_t tile = 0; tile < numtiles; ++tile)
+                segments.insert(segments.end(), tilesegments[l * numtiles + tile].begin(), tilesegments[l * numtiles + tile].end());
+            const auto pointat = [&](std::size_t edge) -> std::pair<double, double> {
+                const auto horizontal = edge < numhorizontal;
+                const auto j = horizontal ? edge / (nx - 1) : (edge - numhorizontal) / nx;
+                const auto i = horizontal ? edge % (nx - 1) : (edge - numhorizontal) % nx;
+                const auto j1 = horizontal ? j : j + 1;
+                const auto i1 = horizontal ? i + 1 : i;
+                const double v0 = valueat(j, i);
+                const double v1 = valueat(j1, i1);
+                const auto t = v1 != v0 ? (level - v0) / (v1 - v0) : 0.5;
+                const auto px = static_cast<double>(x[i]) + t * (static_cast<double>(x[i1]) - static_cast<double>(x[i]));
+                const auto py = static_cast<double>(y[j]) + t * (static_cast<double>(y[j1]) - static_cast<double>(y[j]));
+                return {px, py};
+            };
+            result[l] = stitchsegments(segments, pointat);
+        }
+    });
+    return result;
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -0,0 +1,169 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/Parallel.hpp>
+#include <sciplot/Utils.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The number of series whose standardized values are kept together in a tile of the correlation kernel.
+const auto CORRELATION_TILE_SIZE = 32;
+
+/// The number of samples of every series of a tile standardized at once, so that the two tiles being correlated stay in cache.
+const auto CORRELATION_BLOCK_SIZE = 1024;
+
+/// Return the dot product of the first @p size entries of @p a and @p b.
+/// Four independent partial sums let the compiler vectorize the loop and keep several multiply-adds in flight.
+inline auto dot(const double* a, const double* b, std::size_t size) -> double
+{
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    std::size_t k = 0;
+    for (; k + 4 <= size; k += 4)
+    {
+        s0 += a[k] * b[k];
+        s1 += a[k + 1] * b[k + 1];
+        s2 += a[k + 2] * b[k + 2];
+        s3 += a[k + 3] * b[k + 3];
+    }
+    for (; k < size; ++k)
+        s0 += a[k] * b[k];
+    return (s0 + s1) + (s2 + s3);
+}
+
+/// Return the Pearson correlation matrix (row after row) of the given @p columns (e.g., a vector of series, each with one value per sample).
+/// Only the samples present in every series are used, and missing (NaN) values are replaced by the mean of their series.
+/// Series are standardized block by block into tiles, and the dot products of every pair of tiles computed on separate threads
+/// (pairs of tiles are also split along the samples when there are fewer of them than threads). Series without variance have NaN correlations.
+template <typename Columns>
+auto correlationmatrix(const Columns& columns) -> std::vector<double>
+{
+    const auto n = static_cast<std::size_t>(columns.size());
+    auto size = n ? minsize(columns[0]) : 0;
+    for (std::size_t c = 1; c < n; ++c)
+        size = std::min(size, minsize(columns[c]));
+
+    // The mean of every series and the factor scaling its deviations to unit norm
+    std::vector<double> means(n, 0.0);
+    std::vector<double> scales(n, 0.0);
+    parallelfor(n, std::min(numthreads(n * size), n), [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (auto c = begin; c < end; ++c)
+        {
+            const auto& column = columns[c];
+            auto sum = 0.0;
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const auto v = static_cast<double>(column[i]);
+                if (std::isfinite(v))
+                {
+                    sum += v;
+                    ++count;
+                }
+            }
+            means[c] = count ? sum / count : 0.0;
+            auto squares = 0.0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const auto v = static_cast<double>(column[i]);
+                if (std::isfinite(v))
+                    squares += (v - means[c]) * (v - means[c]);
+            }
+            scales[c] = squares > 0.0 ? 1.0 / std::sqrt(squares) : 0.0;
+        }
+    });
+
+    // The pairs of tiles (upper triangle), each split into slices of samples when there are too few of them to keep every thread busy
+    const auto tile = std::size_t(CORRELATION_TILE_SIZE);
+    const auto numtiles = (n + tile - 1) / tile;
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    for (std::size_t a = 0; a < numtiles; ++a)
+        for (auto b = a; b < numtiles; ++b)
+            pairs.emplace_back(a, b);
+    const auto nthreads = numthreads(n * n * size / 2);
+    const auto numslices = std::max<std::size_t>(1, std::min(nthreads / std::max<std::size_t>(pairs.size(), 1), size / CORRELATION_BLOCK_SIZE));
+    std::vector<std::vector<double>> partial(numslices, std::vector<double>(n * n, 0.0));
+    const auto numitems = pairs.size() * numslices;
+    parallelfor(numitems, std::min(nthreads, numitems), [&](std::size_t begin, std::size_t end, std::size_t) {
+        std::vector<double> bufa(tile * CORRELATION_BLOCK_SIZE);
+        std::vector<double> bufb(tile * CORRELATION_BLOCK_SIZE);
+        const auto standardize = [&](std::size_t t, std::size_t s0, std::size_t s1, std::vector<double>& buffer) {
+            for (auto c = t * tile; c < std::min(n, (t + 1) * tile); ++c)
+            {
+                auto out = buffer.data() + (c - t * tile) * CORRELATION_BLOCK_SIZE;
+                for (auto i = s0; i < s1; ++i)
+                {
+                    const auto v = static_cast<double>(columns[c][i]);
+                    out[i - s0] = std::isfinite(v) ? (v - means[c]) * scales[c] : 0.0;
+                }
+            }
+        };
+        for (auto item = begin; item < end; ++item)
+        {
+            const auto [a, b] = pairs[item / numslices];
+            const auto slice = item % numslices;
+            auto& result = partial[slice];
+            for (auto s0 = slice * size / numslices; s0 < (slice + 1) * size / numslices; s0 += CORRELATION_BLOCK_SIZE)
+            {
+                const auto s1 = std::min<std::size_t>(s0 + CORRELATION_BLOCK_SIZE, (slice + 1) * size / numslices);
+                standardize(a, s0, s1, bufa);
+                if (b != a)
+                    standardize(b, s0, s1, bufb);
+                const auto& other = b != a ? bufb : bufa;
+                for (auto i = a * tile; i < std::min(n, (a + 1) * tile); ++i)
+                    for (auto j = std::max(i, b * tile); j < std::min(n, (b + 1) * tile); ++j)
+                        result[i * n + j] += dot(bufa.data() + (i - a * tile) * CORRELATION_BLOCK_SIZE, other.data() + (j - b * tile) * CORRELATION_BLOCK_SIZE, s1 - s0);
+            }
+        }
+    });
+
+    std::vector<double> correlations(n * n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (auto j = i; j < n; ++j)
+        {
+            auto sum = 0.0;
+            for (const auto& result : partial)
+                sum += result[i * n + j];
+            const auto value = scales[i] > 0.0 && scales[j] > 0.0 ? std::max(-1.0, std::min(1.0, sum)) : NaN;
+            correlations[i * n + j] = correlations[j * n + i] = value;
+        }
+    }
+    return correlations;
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -0,0 +1,372 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/Parallel.hpp>
+#include <sciplot/Utils.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The summary of the rows aggregated into each non-empty bucket (i.e., pixel column) along *x*.
+struct EnvelopeData
+{
+    std::vector<double> x;    ///< The mean of the *x* values in each bucket
+    std::vector<double> y;    ///< The mean of the *y* values in each bucket
+    std::vector<double> low;  ///< The minimum of the low values in each bucket
+    std::vector<double> high; ///< The maximum of the high values in each bucket
+};
+
+/// Return the finite minimum and maximum of the first @p size entries of vector @p x (NaN values are ignored).
+template <typename X>
+auto finiteminmax(const X& x, std::size_t size) -> std::pair<double, double>
+{
+    auto xmin = std::numeric_limits<double>::infinity();
+    auto xmax = -std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto xi = static_cast<double>(x[i]);
+        if (!std::isfinite(xi))
+            continue;
+        xmin = std::min(xmin, xi);
+        xmax = std::max(xmax, xi);
+    }
+    return {xmin, xmax};
+}
+
+/// Return the bucket index of @p xi when the range [@p xmin, @p xmax] is divided into @p numbuckets buckets of equal width.
+inline auto bucketindex(double xi, double xmin, double xmax, std::size_t numbuckets) -> std::size_t
+{
+    if (!(xmax > xmin))
+        return 0;
+    const auto k = static_cast<std::size_t>((xi - xmin) / (xmax - xmin) * static_cast<double>(numbuckets));
+    return std::min(k, numbuckets - 1);
+}
+
+/// Aggregate the rows of @p x and @p y into at most @p numbuckets buckets of equal width along *x*, where the low and high values of row `i` are given by `lowat(i)` and `highat(i)`.
+/// Each bucket spans from the minimum low value to the maximum high value of its rows and is centered at the mean of its *x* and *y* values.
+/// Rows with non-finite values are skipped. The cost is O(n + numbuckets) and the result has at most @p numbuckets rows.
+template <typename X, typename Y, typename LowFn, typename HighFn>
+auto envelopewith(const X& x, const Y& y, std::size_t size, std::size_t numbuckets, const LowFn& lowat, const HighFn& highat) -> EnvelopeData
+{
+    numbuckets = std::max<std::size_t>(numbuckets, 1);
+
+    const auto [xmin, xmax] = finiteminmax(x, size);
+
+    std::vector<std::size_t> count(numbuckets, 0);
+    std::vector<double> sumx(numbuckets, 0.0);
+    std::vector<double> sumy(numbuckets, 0.0);
+    std::vector<double> low(numbuckets, std::numeric_limits<double>::infinity());
+    std::vector<double> high(numbuckets, -std::numeric_limits<double>::infinity());
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto xi = static_cast<double>(x[i]);
+        const auto yi = static_cast<double>(y[i]);
+        const auto li = static_cast<double>(lowat(i));
+        const auto hi = static_cast<double>(highat(i));
+        if (!std::isfinite(xi) || !std::isfinite(yi) || !std::isfinite(li) || !std::isfinite(hi))
+            continue;
+        const auto k = bucketindex(xi, xmin, xmax, numbuckets);
+        count[k] += 1;
+        sumx[k] += xi;
+        sumy[k] += yi;
+        low[k] = std::min(low[k], li);
+        high[k] = std::max(high[k], hi);
+    }
+
+    EnvelopeData result;
+    for (std::size_t k = 0; k < numbuckets; ++k)
+    {
+        if (count[k] == 0)
+            continue;
+        result.x.push_back(sumx[k] / count[k]);
+        result.y.push_back(sumy[k] / count[k]);
+        result.low.push_back(low[k]);
+        result.high.push_back(high[k]);
+    }
+    return result;
+}
+
+/// Aggregate rows with absolute error bounds @p ylow and @p yhigh into at most @p numbuckets buckets along *x* (see @ref envelopewith).
+template <typename X, typename Y, typename YL, typename YH>
+auto envelope(const X& x, const Y& y, const YL& ylow, const YH& yhigh, std::size_t numbuckets) -> EnvelopeData
+{
+    const auto size = minsize(x, y, ylow, yhigh);
+    return envelopewith(
+        x, y, size, numbuckets,
+        [&](std::size_t i) { return ylow[i]; },
+        [&](std::size_t i) { return yhigh[i]; });
+}
+
+/// Aggregate rows with symmetric errors @p ydelta into at most @p numbuckets buckets along *x* (see @ref envelopewith).
+template <typename X, typename Y, typename YD>
+auto envelopedelta(const X& x, const Y& y, const YD& ydelta, std::size_t numbuckets) -> EnvelopeData
+{
+    const auto size = minsize(x, y, ydelta);
+    return envelopewith(
+        x, y, size, numbuckets,
+        [&](std::size_t i) { return static_cast<double>(y[i]) - static_cast<double>(ydelta[i]); },
+        [&](std::size_t i) { return static_cast<double>(y[i]) + static_cast<double>(ydelta[i]); });
+}
+
+/// Append to @p indices the first, lowest, highest and last rows of the run [@p begin, @p end) of a curve, in their original order and without repetitions.
+template <typename Y>
+auto appendm4(std::vector<std::size_t>& indices, const Y& y, std::size_t begin, std::size_t end) -> void
+{
+    if (begin >= end)
+        return;
+    auto imin = begin;
+    auto imax = begin;
+    for (auto i = begin + 1; i < end; ++i)
+    {
+        const auto yi = static_cast<double>(y[i]);
+        if (yi < static_cast<double>(y[imin]) || std::isnan(static_cast<double>(y[imin])))
+            imin = i;
+        if (yi > static_cast<double>(y[imax]) || std::isnan(static_cast<double>(y[imax])))
+            imax = i;
+    }
+    std::size_t run[4] = {begin, imin, imax, end - 1};
+    std::sort(run, run + 4);
+    for (auto i : run)
+        if (indices.empty() || indices.back() != i)
+            indices.push_back(i);
+}
+
+/// Return the indices of the rows of a curve kept when reducing it to @p numcolumns columns along *x* (the M4 reduction).
+/// Every run of consecutive rows falling into the same column is replaced by its first, lowest, highest and last rows, which draws identically to the full curve when @p numcolumns matches the plot width.
+/// If *x* is not sorted and the runs still produce more than @p maxrows rows, consecutive rows are grouped into equally sized runs instead.
+template <typename X, typename Y>
+auto m4indices(const X& x, const Y& y, std::size_t size, std::size_t numcolumns, std::size_t maxrows) -> std::vector<std::size_t>
+{
+    numcolumns = std::max<std::size_t>(numcolumns, 1);
+    const auto [xmin, xmax] = finiteminmax(x, size);
+
+    std::vector<std::size_t> indices;
+    indices.reserve(std::min(size, 4 * numcolumns));
+
+    std::size_t begin = 0;
+    std::size_t column = size ? bucketindex(static_cast<double>(x[0]), xmin, xmax, numcolumns) : 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto xi = static_cast<double>(x[i]);
+        if (!std::isfinite(xi))
+        {
+            // Keep rows with missing x values as they are, since they affect how gnuplot connects the curve
+            appendm4(indices, y, begin, i);
+            indices.push_back(i);
+            begin = i + 1;
+            continue;
+        }
+        const auto k = bucketindex(xi, xmin, xmax, numcolumns);
+        if (k != column)
+        {
+            appendm4(indices, y, begin, i);
+            begin = i;
+            column = k;
+        }
+    }
+    appendm4(indices, y, begin, size);
+
+    if (indices.size() <= std::max<std::size_t>(maxrows, 4))
+        return indices;
+
+    // The x values go back and forth, so group consecutive rows instead
+    indices.clear();
+    const auto numruns = std::max<std::size_t>(maxrows / 4, 1);
+    for (std::size_t r = 0; r < numruns; ++r)
+        appendm4(indices, y, r * size / numruns, (r + 1) * size / numruns);
+    return indices;
+}
+
+/// Return the entries of vector @p v at the given @p indices.
+template <typename V>
+auto gather(const V& v, const std::vector<std::size_t>& indices) -> std::vector<double>
+{
+    std::vector<double> result(indices.size());
+    for (std::size_t i = 0; i < indices.size(); ++i)
+        result[i] = static_cast<double>(v[indices[i]]);
+    return result;
+}
+
+/// Return the indices of the rows of a step curve that remain after removing repeated *y* values.
+/// Only the first and last rows of each run of equal *y* values are kept, which draws identically with the `steps`, `fsteps`, `histeps` and `fillsteps` styles.
+/// The second and second to last rows are kept too, since `histeps` extends the first and last steps by half the distance to them.
+template <typename Y>
+auto runindices(const Y& y, std::size_t size) -> std::vector<std::size_t>
+{
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto samebefore = i > 0 && static_cast<double>(y[i]) == static_cast<double>(y[i - 1]);
+        const auto sameafter = i + 1 < size && static_cast<double>(y[i]) == static_cast<double>(y[i + 1]);
+        if (!(samebefore && sameafter) || i == 1 || i + 2 == size)
+            indices.push_back(i);
+    }
+    return indices;
+}
+
+/// Return the indices of the rows of a step curve kept when reducing it to @p numcolumns columns along *x*.
+/// Runs of repeated *y* values are removed first (see @ref runindices). If more than @p maxrows rows remain, the transitions within each column are collapsed into its first, lowest, highest and last rows (see @ref m4indices), so that every transition wider than a column is kept.
+template <typename X, typename Y>
+auto stepindices(const X& x, const Y& y, std::size_t size, std::size_t numcolumns, std::size_t maxrows) -> std::vector<std::size_t>
+{
+    const auto runs = runindices(y, size);
+    if (maxrows == 0 || runs.size() <= maxrows)
+        return runs;
+    const auto xs = gather(x, runs);
+    const auto ys = gather(y, runs);
+    auto indices = m4indices(xs, ys, runs.size(), numcolumns, maxrows);
+    for (auto& i : indices)
+        i = runs[i];
+    return indices;
+}
+
+/// Return the indices of the rows of a monotone curve (e.g., a cumulative distribution) kept when reducing it to a grid of @p numcolumns by @p numrows pixels.
+/// A row is kept whenever it enters a pixel other than the one of the previous kept row, so that the curve moves by less than a pixel between kept rows,
+/// and the last row is always kept. Pixels are equally sized in the logarithms of *x* or *y* if @p logx or @p logy are true (non-positive values are then skipped).
+/// A monotone curve crosses at most @p numcolumns + @p numrows pixels, which bounds the number of rows kept.
+template <typename X, typename Y>
+auto monotoneindices(const X& x, const Y& y, std::size_t size, std::size_t numcolumns, std::size_t numrows, bool logx, bool logy) -> std::vector<std::size_t>
+{
+    const auto transform = [](double v, bool logarithmic) { return logarithmic ? (v > 0.0 ? std::log(v) : NaN) : v; };
+    std::vector<double> tx(size);
+    std::vector<double> ty(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        tx[i] = transform(static_cast<double>(x[i]), logx);
+        ty[i] = transform(static_cast<double>(y[i]), logy);
+    }
+    const auto [xmin, xmax] = finiteminmax(tx, size);
+    const auto [ymin, ymax] = finiteminmax(ty, size);
+    std::vector<std::size_t> indices;
+    auto lastcolumn = std::numeric_limits<std::size_t>::max();
+    auto lastrow = std::numeric_limits<std::size_t>::max();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (!std::isfinite(tx[i]) || !std::isfinite(ty[i]))
+            continue;
+        const auto column = bucketindex(tx[i], xmin, xmax, std::max<std::size_t>(numcolumns, 1));
+        const auto row = bucketindex(ty[i], ymin, ymax, std::max<std::size_t>(numrows, 1));
+        if (column != lastcolumn || row != lastrow)
+            indices.push_back(i);
+        lastcolumn = column;
+        lastrow = row;
+    }
+    // Keep the last row too, so that the curve ends exactly where it should
+    for (auto i = size; i-- > 0;)
+    {
+        if (std::isfinite(tx[i]) && std::isfinite(ty[i]))
+        {
+            if (indices.empty() || indices.back() != i)
+                indices.push_back(i);
+            break;
+        }
+    }
+    return indices;
+}
+
+/// Return the numbers of columns and rows, at most @p nx and @p ny, to which data of @p nx columns by @p ny rows is reduced to write at most @p maxrows rows (zero for no limit), shrinking both in proportion.
+/// The data written takes `columns * rows` rows if @p area is true (e.g., an image), and `columns + rows` rows otherwise (e.g., a monotone curve crossing a grid of pixels).
+inline auto fitwithin(std::size_t nx, std::size_t ny, std::size_t maxrows, bool area) -> std::pair<std::size_t, std::size_t>
+{
+    const auto rows = area ? nx * ny : nx + ny;
+    if (maxrows == 0 || rows <= maxrows)
+        return {nx, ny};
+    const auto ratio = static_cast<double>(maxrows) / static_cast<double>(rows);
+    const auto scale = area ? std::sqrt(ratio) : ratio;
+    return {std::max<std::size_t>(static_cast<std::size_t>(nx * scale), 1), std::max<std::size_t>(static_cast<std::size_t>(ny * scale), 1)};
+}
+
+/// Return the matrix of @p ny rows and @p nx columns with entry `valueat(j, i)` at row j and column i, stored row after row, reduced to at most @p my rows and @p mx columns
+/// by replacing contiguous blocks of entries with their mean or their maximum, as given by @p pooling (with Pooling::none, every entry is kept).
+/// The blocks of a reduced matrix of my' = min(ny, my) rows and mx' = min(nx, mx) columns differ in size by at most one row or column. Non-finite entries are ignored,
+/// and blocks without finite entries are NaN. The rows of the reduced matrix are computed in parallel.
+template <typename ValueFn>
+auto pool(const ValueFn& valueat, std::size_t nx, std::size_t ny, std::size_t mx, std::size_t my, Pooling pooling) -> std::vector<double>
+{
+    mx = pooling == Pooling::none ? nx : std::max<std::size_t>(std::min(nx, mx), 1);
+    my = pooling == Pooling::none ? ny : std::max<std::size_t>(std::min(ny, my), 1);
+    std::vector<double> pooled(mx * my);
+    if (mx == nx && my == ny)
+    {
+        parallelfor(ny, std::min(numthreads(nx * ny), ny), [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (auto j = begin; j < end; ++j)
+                for (std::size_t i = 0; i < nx; ++i)
+                    pooled[j * nx + i] = valueat(j, i);
+        });
+        return pooled;
+    }
+    parallelfor(my, std::min(numthreads(nx * ny), my), [&](std::size_t begin, std::size_t end, std::size_t) {
+        std::vector<double> accumulated(mx);
+        std::vector<std::size_t> counts(mx);
+        for (auto r = begin; r < end; ++r)
+        {
+            std::fill(accumulated.begin(), accumulated.end(), 0.0);
+            std::fill(counts.begin(), counts.end(), 0);
+            for (auto j = r * ny / my; j < (r + 1) * ny / my; ++j)
+            {
+                for (std::size_t c = 0; c < mx; ++c)
+                {
+                    for (auto i = c * nx / mx; i < (c + 1) * nx / mx; ++i)
+                    {
+                        const double v = valueat(j, i);
+                        if (!std::isfinite(v))
+                            continue;
+                        if (pooling == Pooling::max)
+                            accumulated[c] = counts[c] ? std::max(accumulated[c], v) : v;
+                        else
+                            accumulated[c] += v;
+                        ++counts[c];
+                    }
+                }
+            }
+            for (std::size_t c = 0; c < mx; ++c)
+                pooled[r * mx + c] = counts[c] == 0 ? NaN : pooling == Pooling::max ? accumulated[c] : accumulated[c] / counts[c];
+        }
+    });
+    return pooled;
+}
+
+/// Return the matrix @p z of @p ny rows and @p nx columns (stored row after row) reduced to at most @p my rows and @p mx columns by averaging contiguous blocks of entries (see @ref pool).
+inline auto meanpool(const std::vector<double>& z, std::size_t nx, std::size_t ny, std::size_t mx, std::size_t my) -> std::vector<double>
+{
+    return pool([&](std::size_t j, std::size_t i) { return z[j * nx + i]; }, nx, ny, mx, my, Pooling::mean);
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -77,5 +77,18 @@ const auto DEFAULT_TICS_SCALE_MAJOR_BY = 0.50;
 const auto DEFAULT_TICS_SCALE_MINOR_BY = 0.25;
 const auto DEFAULT_TICS_MINOR_SHOW = false;
 
+const auto DEFAULT_FORMAT_ROWS_PER_SECOND = 4.0e6;  // initial estimate of how fast rows of data are formatted, refined as draws are made
+const auto DEFAULT_GNUPLOT_ROWS_PER_SECOND = 1.0e6; // initial estimate of how fast gnuplot reads and renders rows of data, refined as canvases are saved
+const auto DEFAULT_CALIBRATION_MIN_ROWS = 10000;    // the minimum number of rows for a timing to be used to refine the throughput estimates
+
+const auto DEFAULT_HEXBIN_GRIDSIZE = 50;        // the default number of hexagons across the x range of a hexbin plot
+const auto DEFAULT_HISTOGRAM_MAX_BINS = 2000;   // the maximum number of bins chosen by the automatic binning rules, which would otherwise be unbounded for heavy-tailed samples
+const auto DEFAULT_DENSITY_GRIDSIZE = 512;      // the default number of points at which kernel density estimates are evaluated
+const auto DEFAULT_BOXPLOT_MAX_OUTLIERS = 1000; // the default maximum number of outliers drawn for each box of a box plot
+const auto DEFAULT_BOXPLOT_BOXWIDTH = 0.5;      // the default width of the boxes of a box plot, relative to the distance between them
+const auto DEFAULT_SKETCH_COMPRESSION = 100.0;  // the default compression of quantile sketches, bounding their number of centroids
+const auto DEFAULT_VIOLIN_WIDTH = 0.8;          // the width of the widest violin of a violin plot, relative to the distance between violins
+const auto DEFAULT_FUNCTION_GRIDSIZE = 64;      // the default number of points along each axis of the grid on which functions of two variables are sampled
+
 } // namespace internal
 } // namespace sciplot
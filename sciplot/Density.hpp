@@ -0,0 +1,236 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/FFT.hpp>
+#include <sciplot/Histogram.hpp>
+#include <sciplot/Parallel.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// Return the number of finite samples, their mean and their standard deviation, computed in parallel.
+template <typename S>
+auto samplemoments(const S& samples, std::size_t size) -> std::tuple<std::size_t, double, double>
+{
+    const auto nthreads = numthreads(size);
+    std::vector<std::size_t> counts(nthreads, 0);
+    std::vector<double> sums(nthreads, 0.0);
+    parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        for (auto i = begin; i < end; ++i)
+        {
+            const auto v = static_cast<double>(samples[i]);
+            if (!std::isfinite(v))
+                continue;
+            counts[ithread] += 1;
+            sums[ithread] += v;
+        }
+    });
+    std::size_t count = 0;
+    auto sum = 0.0;
+    for (std::size_t t = 0; t < nthreads; ++t)
+    {
+        count += counts[t];
+        sum += sums[t];
+    }
+    if (count == 0)
+        return {0, NaN, NaN};
+    const auto mean = sum / count;
+    // A second pass over the deviations from the mean avoids the cancellation of the textbook one-pass formula
+    std::vector<double> squares(nthreads, 0.0);
+    parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        for (auto i = begin; i < end; ++i)
+        {
+            const auto v = static_cast<double>(samples[i]);
+            if (std::isfinite(v))
+                squares[ithread] += (v - mean) * (v - mean);
+        }
+    });
+    auto square = 0.0;
+    for (auto s : squares)
+        square += s;
+    return {count, mean, count > 1 ? std::sqrt(square / (count - 1)) : 0.0};
+}
+
+} // namespace internal
+
+/// The class used to specify the bandwidth of the Gaussian kernel of a kernel density estimate.
+class Bandwidth
+{
+  public:
+    /// Return Scott's rule, 1.06 σ n^(-1/5), optimal for normally distributed samples.
+    static auto scott() -> Bandwidth { return Bandwidth(Rule::Scott); }
+
+    /// Return Silverman's rule of thumb, 0.9 min(σ, IQR / 1.34) n^(-1/5), more robust to skewed and multimodal samples.
+    static auto silverman() -> Bandwidth { return Bandwidth(Rule::Silverman); }
+
+    /// Return the given positive bandwidth @p h, in the units of the samples.
+    static auto value(double h) -> Bandwidth
+    {
+        if (!(h > 0.0 && std::isfinite(h)))
+            throw std::invalid_argument("The bandwidth of a kernel density estimate must be positive.");
+        return Bandwidth(Rule::Fixed, h);
+    }
+
+    /// Return the bandwidth for the first @p size entries of @p samples, whose number of finite entries and standard deviation are @p count and @p stddev.
+    template <typename S>
+    auto select(const S& samples, std::size_t size, std::size_t count, double stddev) const -> double;
+
+  private:
+    /// The ways in which the bandwidth can be specified.
+    enum class Rule
+    {
+        Scott,
+        Silverman,
+        Fixed
+    };
+
+    /// Construct a Bandwidth object with given rule.
+    Bandwidth(Rule rule, double value = NaN)
+        : m_rule(rule), m_value(value) {}
+
+    /// The way in which the bandwidth is specified.
+    Rule m_rule;
+
+    /// The bandwidth if it is given explicitly.
+    double m_value = NaN;
+};
+
+template <typename S>
+auto Bandwidth::select(const S& samples, std::size_t size, std::size_t count, double stddev) const -> double
+{
+    if (m_rule == Rule::Fixed)
+        return m_value;
+    auto spread = stddev;
+    auto factor = 1.06;
+    if (m_rule == Rule::Silverman)
+    {
+        const auto iqr = internal::interquartilerange(samples, size).second / 1.34;
+        spread = (iqr > 0.0) ? std::min(stddev, iqr) : stddev;
+        factor = 0.9;
+    }
+    const auto h = factor * spread * std::pow(static_cast<double>(std::max<std::size_t>(count, 1)), -0.2);
+    // All samples have the same value, so use a unit bandwidth as done for the width of histogram bins
+    return h > 0.0 ? h : 1.0;
+}
+
+namespace internal
+{
+
+/// Return the Gaussian kernel density estimate of the finite @p samples with given @p bandwidth, evaluated at @p numpoints equally spaced points
+/// spanning the range of the samples extended by three bandwidths on both sides.
+/// The samples are linearly binned onto the points in parallel and the binned counts convolved with the kernel by FFT, which costs O(n + m log m) for n samples and m points.
+template <typename S>
+auto kde(const S& samples, std::size_t size, const Bandwidth& bandwidth, std::size_t numpoints) -> std::pair<std::vector<double>, std::vector<double>>
+{
+    const auto [count, mean, stddev] = samplemoments(samples, size);
+    if (count == 0)
+        return {};
+    const auto h = bandwidth.select(samples, size, count, stddev);
+    const auto [finite, min, max] = samplerange(samples, size);
+    const auto m = std::max<std::size_t>(numpoints, 2);
+    const auto lo = min - 3.0 * h;
+    const auto hi = max + 3.0 * h;
+    const auto delta = (hi - lo) / (m - 1);
+
+    // Share every sample between its two nearest grid points, in proportion to their proximity
+    const auto nthreads = numthreads(size);
+    std::vector<std::vector<double>> partial(nthreads, std::vector<double>(m, 0.0));
+    parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        auto& weights = partial[ithread];
+        for (auto i = begin; i < end; ++i)
+        {
+            const auto v = static_cast<double>(samples[i]);
+            if (!std::isfinite(v))
+                continue;
+            const auto t = (v - lo) / delta;
+            const auto k = std::min(static_cast<std::size_t>(t), m - 2);
+            const auto fraction = t - k;
+            weights[k] += 1.0 - fraction;
+            weights[k + 1] += fraction;
+        }
+    });
+
+    // Convolve the binned counts with the kernel, truncated at four bandwidths, with enough zero padding for the circular convolution not to wrap around
+    const auto lags = std::min(m - 1, static_cast<std::size_t>(std::ceil(4.0 * h / delta)));
+    const auto n = nextpow2(m + lags);
+    std::vector<std::complex<double>> data(n);
+    std::vector<std::complex<double>> kernel(n);
+    for (std::size_t t = 0; t < nthreads; ++t)
+        for (std::size_t k = 0; k < m; ++k)
+            data[k] += partial[t][k];
+    const auto norm = 1.0 / (count * h * std::sqrt(2.0 * PI));
+    for (std::size_t l = 0; l <= lags; ++l)
+    {
+        const auto z = l * delta / h;
+        kernel[l] = norm * std::exp(-0.5 * z * z);
+        if (l > 0)
+            kernel[n - l] = kernel[l];
+    }
+    fft(data);
+    fft(kernel);
+    for (std::size_t k = 0; k < n; ++k)
+        data[k] *= kernel[k];
+    fft(data, true);
+
+    std::vector<double> x(m);
+    std::vector<double> density(m);
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        x[k] = lo + k * delta;
+        density[k] = std::max(data[k].real(), 0.0); // remove tiny negative values left by rounding errors
+    }
+    return {std::move(x), std::move(density)};
+}
+
+/// Return the kernel density estimates of the given @p groups of samples (e.g., a vector of vectors), each computed on its own thread when there are several groups.
+template <typename Groups>
+auto kdes(const Groups& groups, const Bandwidth& bandwidth, std::size_t numpoints) -> std::vector<std::pair<std::vector<double>, std::vector<double>>>
+{
+    const auto numgroups = static_cast<std::size_t>(groups.size());
+    std::vector<std::pair<std::vector<double>, std::vector<double>>> densities(numgroups);
+    parallelfor(numgroups, numthreads(numgroups, 1), [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (auto g = begin; g < end; ++g)
+            densities[g] = kde(groups[g], minsize(groups[g]), bandwidth, numpoints);
+    });
+    return densities;
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -37,4 +37,19 @@ enum class Extension
     eps
 };
 
+/// The orders in which the entries of a matrix can be stored contiguously.
+enum class MatrixLayout
+{
+    rowmajor,   ///< The entries of every row are contiguous
+    columnmajor ///< The entries of every column are contiguous
+};
+
+/// The ways blocks of matrix entries sharing a pixel can be reduced to a single value.
+enum class Pooling
+{
+    none, ///< Keep every entry, even if there are more entries than pixels
+    mean, ///< Take the mean of the finite entries in every block
+    max   ///< Take the maximum of the finite entries in every block
+};
+
 } // namespace sciplot
@@ -0,0 +1,92 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// Return the smallest power of two not less than @p n.
+inline auto nextpow2(std::size_t n) -> std::size_t
+{
+    std::size_t p = 1;
+    while (p < n)
+        p <<= 1;
+    return p;
+}
+
+/// Replace @p data by its discrete Fourier transform (or by its inverse, including the division by the size, if @p inverse is true).
+/// The size of @p data must be a power of two. The transform is the iterative radix-2 Cooley-Tukey algorithm, in place and in O(n log n).
+inline auto fft(std::vector<std::complex<double>>& data, bool inverse = false) -> void
+{
+    const auto n = data.size();
+    if (n & (n - 1))
+        throw std::invalid_argument("The size of the data given to the FFT must be a power of two.");
+    // Reorder the data so that the butterflies below can be applied in place
+    for (std::size_t i = 1, j = 0; i < n; ++i)
+    {
+        auto bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(data[i], data[j]);
+    }
+    for (std::size_t len = 2; len <= n; len <<= 1)
+    {
+        const auto angle = (inverse ? 2.0 : -2.0) * PI / static_cast<double>(len);
+        const std::complex<double> step(std::cos(angle), std::sin(angle));
+        for (std::size_t i = 0; i < n; i += len)
+        {
+            std::complex<double> w(1.0, 0.0);
+            for (std::size_t k = 0; k < len / 2; ++k)
+            {
+                const auto u = data[i + k];
+                const auto v = data[i + k + len / 2] * w;
+                data[i + k] = u + v;
+                data[i + k + len / 2] = u - v;
+                w *= step;
+            }
+        }
+    }
+    if (inverse)
+        for (auto& value : data)
+            value /= static_cast<double>(n);
+}
+
+} // namespace internal
+} // namespace sciplot
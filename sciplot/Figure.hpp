@@ -62,6 +62,12 @@ static constexpr auto ReprPlotVisitor = Overload{
     [](const Plot3D& p)
     { return p.repr(); }};
 
+static constexpr auto RenderStatsPlotVisitor = Overload{
+    [](const Plot2D& p)
+    { return p.renderStats(); },
+    [](const Plot3D& p)
+    { return p.renderStats(); }};
+
 static constexpr auto CleanupPlotVisitor = Overload{
     [](const Plot2D& p)
     { p.cleanup(); },
@@ -109,6 +115,9 @@ class Figure
     /// Delete all files used to store plot data or scripts.
     auto cleanup() const -> void;
 
+    /// Return the statistics recorded for the draw calls of all plots in the figure.
+    auto renderStats() const -> RenderStats;
+
     /// Convert this figure into a gnuplot formatted string.
     auto repr() const -> std::string;
 
@@ -250,6 +259,20 @@ inline auto Figure::saveplotdata() const -> void
     }
 }
 
+inline auto Figure::renderStats() const -> RenderStats
+{
+    RenderStats stats;
+    for (const auto& row : m_plots)
+    {
+        for (const auto& plot : row)
+        {
+            const auto plotstats = std::visit(RenderStatsPlotVisitor, plot);
+            stats.draws.insert(stats.draws.end(), plotstats.draws.begin(), plotstats.draws.end());
+        }
+    }
+    return stats;
+}
+
 inline auto Figure::cleanup() const -> void
 {
     for (const auto& row : m_plots)
@@ -0,0 +1,393 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/Parallel.hpp>
+#include <sciplot/Utils.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The triangular factor of a least-squares problem, updated one row at a time with Givens rotations so that the rows never need to be stored.
+/// The factor R and the rotated right-hand side z satisfy RᵀR = AᵀA and Rᵀz = Aᵀb for the rows (A, b) added so far.
+struct LeastSquares
+{
+    /// Construct a LeastSquares object for problems with @p numcoeffs coefficients.
+    explicit LeastSquares(std::size_t numcoeffs = 0)
+        : p(numcoeffs), r(numcoeffs * numcoeffs, 0.0), z(numcoeffs, 0.0) {}
+
+    /// Add the row with coefficients @p a (overwritten) and right-hand side @p b.
+    auto addrow(double* a, double b) -> void
+    {
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            if (a[j] == 0.0)
+                continue;
+            auto& rjj = r[j * p + j];
+            const auto norm = std::hypot(rjj, a[j]);
+            const auto c = rjj / norm;
+            const auto s = a[j] / norm;
+            rjj = norm;
+            for (auto k = j + 1; k < p; ++k)
+            {
+                const auto rjk = r[j * p + k];
+                r[j * p + k] = c * rjk + s * a[k];
+                a[k] = c * a[k] - s * rjk;
+            }
+            const auto zj = z[j];
+            z[j] = c * zj + s * b;
+            b = c * b - s * zj;
+        }
+        rss += b * b; // what the rotations leave of b cannot be fitted
+        count += 1;
+    }
+
+    /// Add the rows summarized by @p other, e.g. those added on another thread.
+    auto merge(const LeastSquares& other) -> void
+    {
+        const auto total = count + other.count;
+        std::vector<double> a(p);
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            a.assign(other.r.begin() + j * p, other.r.begin() + (j + 1) * p);
+            addrow(a.data(), other.z[j]);
+        }
+        rss += other.rss;
+        count = total;
+    }
+
+    /// Return the coefficients minimizing the sum of squared residuals (those left undetermined by the rows are zero).
+    auto solve() const -> std::vector<double>
+    {
+        std::vector<double> coeffs(p, 0.0);
+        for (auto j = p; j-- > 0;)
+        {
+            if (!(std::abs(r[j * p + j]) > 0.0))
+                continue;
+            auto sum = z[j];
+            for (auto k = j + 1; k < p; ++k)
+                sum -= r[j * p + k] * coeffs[k];
+            coeffs[j] = sum / r[j * p + j];
+        }
+        return coeffs;
+    }
+
+    /// Return φᵀ(AᵀA)⁻¹φ for the given row @p phi, the variance of the fitted value at that row in units of the residual variance.
+    auto leverage(const std::vector<double>& phi) const -> double
+    {
+        // Solve Rᵀw = φ, so that φᵀ(RᵀR)⁻¹φ = wᵀw
+        std::vector<double> w(p, 0.0);
+        auto sum = 0.0;
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            auto value = phi[j];
+            for (std::size_t k = 0; k < j; ++k)
+                value -= r[k * p + j] * w[k];
+            w[j] = std::abs(r[j * p + j]) > 0.0 ? value / r[j * p + j] : 0.0;
+            sum += w[j] * w[j];
+        }
+        return sum;
+    }
+
+    /// The number of coefficients.
+    std::size_t p;
+
+    /// The upper triangular factor R, stored row after row.
+    std::vector<double> r;
+
+    /// The right-hand side rotated along with the rows.
+    std::vector<double> z;
+
+    /// The sum of the squared residuals.
+    double rss = 0.0;
+
+    /// The number of rows added.
+    std::size_t count = 0;
+};
+
+/// Write in @p out the first @p n Chebyshev polynomials evaluated at @p t, a well-conditioned basis for polynomials on [-1, 1].
+inline auto chebyshev(double t, std::size_t n, double* out) -> void
+{
+    for (std::size_t k = 0; k < n; ++k)
+        out[k] = k == 0 ? 1.0 : k == 1 ? t : 2.0 * t * out[k - 1] - out[k - 2];
+}
+
+/// Return the coefficients in powers of *x* of the polynomial with Chebyshev coefficients @p coeffs in t = (x - @p center) / @p halfwidth.
+inline auto chebyshevtomonomial(const std::vector<double>& coeffs, double center, double halfwidth) -> std::vector<double>
+{
+    const auto n = coeffs.size();
+    // Powers of t in each Chebyshev polynomial, accumulated into the coefficients of powers of t
+    std::vector<double> tpowers(n, 0.0);
+    std::vector<double> previous(n, 0.0), current(n, 0.0), next(n, 0.0);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        std::fill(next.begin(), next.end(), 0.0);
+        if (k == 0)
+            next[0] = 1.0;
+        else if (k == 1)
+            next[1] = 1.0;
+        else
+            for (std::size_t i = 0; i < n; ++i)
+                next[i] = (i > 0 ? 2.0 * current[i - 1] : 0.0) - previous[i];
+        for (std::size_t i = 0; i < n; ++i)
+            tpowers[i] += coeffs[k] * next[i];
+        previous = current;
+        current = next;
+    }
+    // Expand every power of t = (x - center) / halfwidth with the binomial theorem
+    std::vector<double> xpowers(n, 0.0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        auto binomial = 1.0; // i choose j
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            xpowers[j] += tpowers[i] * binomial * std::pow(-center, static_cast<double>(i - j)) / std::pow(halfwidth, static_cast<double>(i));
+            binomial = binomial * (i - j) / (j + 1);
+        }
+    }
+    return xpowers;
+}
+
+/// Return the quantile of the standard normal distribution at probability @p p in (0, 1).
+inline auto normalquantile(double p) -> double
+{
+    auto lo = -40.0;
+    auto hi = 40.0;
+    for (auto iter = 0; iter < 100; ++iter)
+    {
+        const auto mid = 0.5 * (lo + hi);
+        if (0.5 * std::erfc(-mid / std::sqrt(2.0)) < p)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return 0.5 * (lo + hi);
+}
+
+/// Return true if the row (@p x, @p y) is fitted, i.e., if both are finite and, when @p positivey is true (e.g., for the logarithm of an exponential model), if @p y is positive.
+inline auto fittable(double x, double y, bool positivey) -> bool
+{
+    return std::isfinite(x) && std::isfinite(y) && (!positivey || y > 0.0);
+}
+
+/// Return the minimum and maximum *x* of the fittable rows (see @ref fittable) among the first @p size rows of @p x and @p y, computed in parallel (infinite if there are none).
+template <typename X, typename Y>
+auto fitrange(const X& x, const Y& y, std::size_t size, bool positivey) -> std::pair<double, double>
+{
+    const auto nthreads = numthreads(size);
+    std::vector<double> mins(nthreads, std::numeric_limits<double>::infinity());
+    std::vector<double> maxs(nthreads, -std::numeric_limits<double>::infinity());
+    parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        for (auto i = begin; i < end; ++i)
+        {
+            const auto xi = static_cast<double>(x[i]);
+            if (!fittable(xi, static_cast<double>(y[i]), positivey))
+                continue;
+            mins[ithread] = std::min(mins[ithread], xi);
+            maxs[ithread] = std::max(maxs[ithread], xi);
+        }
+    });
+    return {*std::min_element(mins.begin(), mins.end()), *std::max_element(maxs.begin(), maxs.end())};
+}
+
+} // namespace internal
+
+/// The model fitted to data by a least-squares @ref Fit.
+class FitModel
+{
+  public:
+    /// Return the straight line y = c0 + c1 x.
+    static auto linear() -> FitModel { return FitModel(Kind::Polynomial, 1); }
+
+    /// Return the polynomial y = c0 + c1 x + ... + cd x^d of given @p degree.
+    static auto polynomial(std::size_t degree) -> FitModel { return FitModel(Kind::Polynomial, degree); }
+
+    /// Return the exponential y = a exp(b x), fitted as the straight line ln y = ln a + b x (so only points with positive *y* are used).
+    static auto exponential() -> FitModel { return FitModel(Kind::Exponential, 1); }
+
+  private:
+    friend class Fit;
+
+    /// The kinds of models.
+    enum class Kind
+    {
+        Polynomial,
+        Exponential
+    };
+
+    /// Construct a FitModel object with given kind and degree.
+    FitModel(Kind kind, std::size_t degree)
+        : m_kind(kind), m_degree(degree) {}
+
+    /// The kind of the model.
+    Kind m_kind;
+
+    /// The degree of the polynomial fitted (in ln y for exponentials).
+    std::size_t m_degree;
+};
+
+/// The class used to fit a model to (x, y) points by least squares, reading the points once and in parallel.
+/// The points are accumulated into a triangular factor with Givens rotations (a streaming QR factorization), in a Chebyshev basis over the range of *x*,
+/// which keeps high degrees and large or offset *x* values well conditioned. Points with missing coordinates are skipped.
+class Fit
+{
+  public:
+    /// Construct a Fit object fitting the given @p model to the points with coordinates @p x and @p y.
+    template <typename X, typename Y>
+    Fit(const X& x, const Y& y, const FitModel& model = FitModel::linear());
+
+    /// Return the coefficients of the fitted model, c0, c1, ..., cd for polynomials and a, b for exponentials.
+    auto coefficients() const -> std::vector<double>;
+
+    /// Return the value of the fitted model at @p x.
+    auto operator()(double x) const -> double;
+
+    /// Return the bounds of the confidence interval at given @p level of the fitted model at @p x, based on the normal approximation.
+    auto confidenceInterval(double x, double level = 0.95) const -> std::pair<double, double>;
+
+    /// Return the number of points fitted.
+    auto count() const -> std::size_t { return m_lsq.count; }
+
+    /// Return the standard deviation of the residuals (of ln y for exponentials).
+    auto residualStdDev() const -> double;
+
+    /// Return the smallest *x* of the points fitted.
+    auto xmin() const -> double { return m_center - m_halfwidth; }
+
+    /// Return the largest *x* of the points fitted.
+    auto xmax() const -> double { return m_center + m_halfwidth; }
+
+  private:
+    /// Return the basis functions of the model at @p x.
+    auto basis(double x) const -> std::vector<double>;
+
+    /// The fitted model.
+    FitModel m_model;
+
+    /// The center of the range of *x*.
+    double m_center = 0.0;
+
+    /// The half width of the range of *x* (one if all *x* are equal).
+    double m_halfwidth = 1.0;
+
+    /// The least-squares problem in the Chebyshev basis.
+    internal::LeastSquares m_lsq;
+
+    /// The Chebyshev coefficients minimizing the squared residuals.
+    std::vector<double> m_coeffs;
+};
+
+template <typename X, typename Y>
+Fit::Fit(const X& x, const Y& y, const FitModel& model)
+    : m_model(model)
+{
+    const auto size = internal::minsize(x, y);
+    const auto p = m_model.m_degree + 1;
+    const auto exponential = m_model.m_kind == FitModel::Kind::Exponential;
+    // Center the basis on the rows that are fitted, as any other row may lie far away from them
+    const auto [min, max] = internal::fitrange(x, y, size, exponential);
+    if (min <= max)
+    {
+        m_center = 0.5 * (min + max);
+        m_halfwidth = max > min ? 0.5 * (max - min) : 1.0;
+    }
+    const auto nthreads = internal::numthreads(size);
+    std::vector<internal::LeastSquares> partial(nthreads, internal::LeastSquares(p));
+    internal::parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        auto& lsq = partial[ithread];
+        std::vector<double> row(p);
+        for (auto i = begin; i < end; ++i)
+        {
+            const auto xi = static_cast<double>(x[i]);
+            const auto yi = static_cast<double>(y[i]);
+            if (!internal::fittable(xi, yi, exponential))
+                continue;
+            internal::chebyshev((xi - m_center) / m_halfwidth, p, row.data());
+            lsq.addrow(row.data(), exponential ? std::log(yi) : yi);
+        }
+    });
+    m_lsq = partial[0];
+    for (std::size_t t = 1; t < nthreads; ++t)
+        m_lsq.merge(partial[t]);
+    m_coeffs = m_lsq.solve();
+}
+
+inline auto Fit::coefficients() const -> std::vector<double>
+{
+    const auto coeffs = internal::chebyshevtomonomial(m_coeffs, m_center, m_halfwidth);
+    if (m_model.m_kind == FitModel::Kind::Exponential)
+        return {std::exp(coeffs[0]), coeffs[1]};
+    return coeffs;
+}
+
+inline auto Fit::operator()(double x) const -> double
+{
+    const auto phi = basis(x);
+    auto value = 0.0;
+    for (std::size_t k = 0; k < phi.size(); ++k)
+        value += m_coeffs[k] * phi[k];
+    return m_model.m_kind == FitModel::Kind::Exponential ? std::exp(value) : value;
+}
+
+inline auto Fit::confidenceInterval(double x, double level) const -> std::pair<double, double>
+{
+    if (!(level > 0.0 && level < 1.0))
+        throw std::invalid_argument("The level of a confidence interval must be in (0, 1).");
+    const auto phi = basis(x);
+    auto value = 0.0;
+    for (std::size_t k = 0; k < phi.size(); ++k)
+        value += m_coeffs[k] * phi[k];
+    const auto halfwidth = internal::normalquantile(0.5 + 0.5 * level) * residualStdDev() * std::sqrt(m_lsq.leverage(phi));
+    if (m_model.m_kind == FitModel::Kind::Exponential)
+        return {std::exp(value - halfwidth), std::exp(value + halfwidth)};
+    return {value - halfwidth, value + halfwidth};
+}
+
+inline auto Fit::residualStdDev() const -> double
+{
+    return m_lsq.count > m_lsq.p ? std::sqrt(m_lsq.rss / (m_lsq.count - m_lsq.p)) : NaN;
+}
+
+inline auto Fit::basis(double x) const -> std::vector<double>
+{
+    std::vector<double> phi(m_lsq.p);
+    internal::chebyshev((x - m_center) / m_halfwidth, phi.size(), phi.data());
+    return phi;
+}
+
+} // namespace sciplot
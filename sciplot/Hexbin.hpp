@@ -0,0 +1,179 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Histogram.hpp>
+#include <sciplot/Parallel.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The layout of a grid of regular hexagons (regular when the x and y ranges are drawn with equal lengths), with pointy tops.
+/// The hexagon centers form two interleaved rectangular lattices: one at the nodes of a grid of `nx` by `ny` cells and one at the centers of these cells.
+struct HexLayout
+{
+    double xmin = 0.0;     ///< The x coordinate of the first hexagon center
+    double ymin = 0.0;     ///< The y coordinate of the first hexagon center
+    double dx = 1.0;       ///< The horizontal distance between neighbouring hexagon centers in a row
+    double dy = 1.0;       ///< The vertical distance between every other row of hexagon centers
+    std::size_t nx = 1;    ///< The number of cells of the rectangular grid along x
+    std::size_t ny = 1;    ///< The number of cells of the rectangular grid along y
+
+    /// Return the number of hexagons, some of which lie on the border and are only partially covered by the grid.
+    auto numcells() const -> std::size_t { return (nx + 1) * (ny + 1) + nx * ny; }
+
+    /// Return the index of the hexagon containing the point (@p x, @p y), or @ref numcells if it falls outside the grid.
+    auto index(double x, double y) const -> std::size_t
+    {
+        const auto u = (x - xmin) / dx;
+        const auto v = (y - ymin) / dy;
+        if (!(u >= 0.0 && u <= nx && v >= 0.0 && v <= ny))
+            return numcells();
+        return cell(u, v);
+    }
+
+    /// Return the index of the hexagon containing the point at (@p u, @p v) in units of @ref dx and @ref dy from the first hexagon center, which must lie within the grid.
+    auto cell(double u, double v) const -> std::size_t
+    {
+        // The nearest node and the nearest cell center, in units where the vertical distances are stretched so that the hexagons are regular
+        const auto i1 = std::round(u);
+        const auto j1 = std::round(v);
+        const auto i2 = std::min(std::floor(u), nx - 1.0);
+        const auto j2 = std::min(std::floor(v), ny - 1.0);
+        const auto d1 = (u - i1) * (u - i1) + 3.0 * (v - j1) * (v - j1);
+        const auto d2 = (u - i2 - 0.5) * (u - i2 - 0.5) + 3.0 * (v - j2 - 0.5) * (v - j2 - 0.5);
+        if (d1 <= d2)
+            return static_cast<std::size_t>(i1) + (nx + 1) * static_cast<std::size_t>(j1);
+        return (nx + 1) * (ny + 1) + static_cast<std::size_t>(i2) + nx * static_cast<std::size_t>(j2);
+    }
+
+    /// Return the center of the hexagon with given index @p k.
+    auto center(std::size_t k) const -> std::pair<double, double>
+    {
+        const auto numnodes = (nx + 1) * (ny + 1);
+        if (k < numnodes)
+            return {xmin + (k % (nx + 1)) * dx, ymin + (k / (nx + 1)) * dy};
+        k -= numnodes;
+        return {xmin + (k % nx + 0.5) * dx, ymin + (k / nx + 0.5) * dy};
+    }
+};
+
+/// The vertices of a hexagon around its center, in units of @ref HexLayout::dx and @ref HexLayout::dy, starting and ending at the same vertex.
+const double HEXAGON_VERTICES[7][2] = {{0.5, 1.0 / 6.0}, {0.0, 1.0 / 3.0}, {-0.5, 1.0 / 6.0}, {-0.5, -1.0 / 6.0}, {0.0, -1.0 / 3.0}, {0.5, -1.0 / 6.0}, {0.5, 1.0 / 6.0}};
+
+/// Return the layout of @p gridsize hexagons across [@p xmin, @p xmax] and as many as needed for regular hexagons across [@p ymin, @p ymax] (assuming both ranges are drawn with equal lengths).
+inline auto hexlayout(double xmin, double xmax, double ymin, double ymax, std::size_t gridsize) -> HexLayout
+{
+    if (!(xmax > xmin))
+    {
+        xmin -= 0.5;
+        xmax += 0.5;
+    }
+    if (!(ymax > ymin))
+    {
+        ymin -= 0.5;
+        ymax += 0.5;
+    }
+    HexLayout layout;
+    layout.nx = std::max<std::size_t>(gridsize, 1);
+    layout.ny = std::max<std::size_t>(static_cast<std::size_t>(layout.nx / std::sqrt(3.0)), 1);
+    layout.xmin = xmin;
+    layout.ymin = ymin;
+    layout.dx = (xmax - xmin) / layout.nx;
+    layout.dy = (ymax - ymin) / layout.ny;
+    return layout;
+}
+
+/// Return the sum of the weights of the points (@p x, @p y) falling into each hexagon of @p layout, where `weightat(i)` is the weight of point `i`.
+/// The points are split among threads, each accumulating its own cells, which are summed at the end.
+template <typename X, typename Y, typename WeightFn>
+auto hexbincounts(const X& x, const Y& y, std::size_t size, const HexLayout& layout, const WeightFn& weightat) -> std::vector<double>
+{
+    const auto numcells = layout.numcells();
+    const auto nthreads = numthreads(size);
+    // Every thread has one extra cell collecting the points outside the grid, which avoids a branch in the inner loop
+    std::vector<std::vector<double>> partial(nthreads, std::vector<double>(numcells + 1, 0.0));
+    parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        auto& counts = partial[ithread];
+        std::size_t indices[BINNING_BLOCK_SIZE];
+        for (auto b = begin; b < end; b += BINNING_BLOCK_SIZE)
+        {
+            const auto m = std::min<std::size_t>(BINNING_BLOCK_SIZE, end - b);
+            for (std::size_t j = 0; j < m; ++j)
+                indices[j] = layout.index(static_cast<double>(x[b + j]), static_cast<double>(y[b + j]));
+            for (std::size_t j = 0; j < m; ++j)
+                counts[indices[j]] += static_cast<double>(weightat(b + j));
+        }
+    });
+    auto& counts = partial.front();
+    for (std::size_t t = 1; t < nthreads; ++t)
+        for (std::size_t k = 0; k < numcells; ++k)
+            counts[k] += partial[t][k];
+    counts.pop_back();
+    return counts;
+}
+
+/// Return the layout and the counts of @p gridsize hexagons across the range of the finer @p layout, each summing the @p counts of the finer hexagons whose centers it contains.
+/// This coarsens the grid without binning the points again, at the cost of assigning every finer hexagon to a single coarser one as a whole.
+inline auto coarsenhexbin(const HexLayout& layout, const std::vector<double>& counts, std::size_t gridsize) -> std::pair<HexLayout, std::vector<double>>
+{
+    auto coarse = hexlayout(layout.xmin, layout.xmin + layout.nx * layout.dx, layout.ymin, layout.ymin + layout.ny * layout.dy, gridsize);
+    std::vector<double> coarsecounts(coarse.numcells(), 0.0);
+    for (std::size_t k = 0; k < counts.size(); ++k)
+    {
+        if (counts[k] == 0.0)
+            continue;
+        const auto [cx, cy] = layout.center(k);
+        // Clamp the centers on the border of the grid, which may fall just outside it after rounding
+        const auto u = std::clamp((cx - coarse.xmin) / coarse.dx, 0.0, static_cast<double>(coarse.nx));
+        const auto v = std::clamp((cy - coarse.ymin) / coarse.dy, 0.0, static_cast<double>(coarse.ny));
+        coarsecounts[coarse.cell(u, v)] += counts[k];
+    }
+    return {std::move(coarse), std::move(coarsecounts)};
+}
+
+/// Return the layout and the weighted counts of the hexagons of the points (@p x, @p y) spanning their range with @p gridsize hexagons across.
+template <typename X, typename Y, typename WeightFn>
+auto hexbin(const X& x, const Y& y, std::size_t size, std::size_t gridsize, const WeightFn& weightat) -> std::pair<HexLayout, std::vector<double>>
+{
+    const auto [countx, xmin, xmax] = samplerange(x, size);
+    const auto [county, ymin, ymax] = samplerange(y, size);
+    auto layout = (countx && county) ? hexlayout(xmin, xmax, ymin, ymax, gridsize) : hexlayout(0.0, 1.0, 0.0, 1.0, gridsize);
+    auto counts = hexbincounts(x, y, size, layout, weightat);
+    return {std::move(layout), std::move(counts)};
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -0,0 +1,652 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/Default.hpp>
+#include <sciplot/Parallel.hpp>
+#include <sciplot/Utils.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The number of samples whose bin indices are computed together before the bins are incremented, so that the index computation can be vectorized.
+const auto BINNING_BLOCK_SIZE = 256;
+
+/// The edges of a set of bins together with what is needed to find the bin of a value.
+struct BinLayout
+{
+    std::vector<double> edges;  ///< The edges of the bins (one more than the number of bins)
+    bool logarithmic = false;   ///< Whether the bins are equally spaced in the logarithm of the values
+    bool uniform = false;       ///< Whether the bins (or the logarithms of their edges) are equally spaced, so that the bin of a value is found in O(1)
+    double origin = 0.0;        ///< The first edge (or its logarithm) if the bins are uniform
+    double scale = 0.0;         ///< The inverse of the bin width (in logarithmic units if logarithmic) if the bins are uniform
+
+    /// Return the number of bins.
+    auto numbins() const -> std::size_t { return edges.empty() ? 0 : edges.size() - 1; }
+
+    /// Return the index of the bin containing @p value, or @ref numbins if it falls outside all bins (the last edge belongs to the last bin).
+    auto index(double value) const -> std::size_t
+    {
+        const auto n = numbins();
+        if (!(value >= edges.front() && value <= edges.back()))
+            return n;
+        if (uniform)
+        {
+            const auto t = logarithmic ? std::log(value) : value;
+            auto k = std::min(static_cast<std::size_t>(std::max((t - origin) * scale, 0.0)), n - 1);
+            // Correct rounding errors so that values on an edge always belong to the bin starting there
+            if (value < edges[k])
+                k -= 1;
+            else if (k + 1 < n && value >= edges[k + 1])
+                k += 1;
+            return k;
+        }
+        const auto k = static_cast<std::size_t>(std::upper_bound(edges.begin(), edges.end(), value) - edges.begin());
+        return std::min(k, n) - 1;
+    }
+};
+
+/// Return a layout of @p numbins bins equally spaced between @p min and @p max.
+inline auto uniformlayout(double min, double max, std::size_t numbins) -> BinLayout
+{
+    numbins = std::max<std::size_t>(numbins, 1);
+    if (!(max > min))
+    {
+        // All samples have the same value, so center a unit-wide bin on it
+        min -= 0.5;
+        max += 0.5;
+    }
+    BinLayout layout;
+    layout.edges.resize(numbins + 1);
+    for (std::size_t i = 0; i <= numbins; ++i)
+        layout.edges[i] = min + i * (max - min) / numbins;
+    layout.edges.back() = max;
+    layout.uniform = true;
+    layout.origin = min;
+    layout.scale = numbins / (max - min);
+    return layout;
+}
+
+/// Return a layout of @p numbins bins equally spaced in logarithmic scale between the positive values @p min and @p max.
+inline auto loglayout(double min, double max, std::size_t numbins) -> BinLayout
+{
+    if (!(min > 0.0))
+        throw std::invalid_argument("Logarithmic bins require a positive range of values.");
+    numbins = std::max<std::size_t>(numbins, 1);
+    if (!(max > min))
+        max = min * 10.0;
+    const auto logmin = std::log(min);
+    const auto logmax = std::log(max);
+    BinLayout layout;
+    layout.edges.resize(numbins + 1);
+    for (std::size_t i = 0; i <= numbins; ++i)
+        layout.edges[i] = std::exp(logmin + i * (logmax - logmin) / numbins);
+    layout.edges.front() = min;
+    layout.edges.back() = max;
+    layout.logarithmic = true;
+    layout.uniform = true;
+    layout.origin = logmin;
+    layout.scale = numbins / (logmax - logmin);
+    return layout;
+}
+
+/// Return a layout with the given bin @p edges, which must be sorted in ascending order.
+inline auto explicitlayout(std::vector<double> edges) -> BinLayout
+{
+    if (edges.size() < 2)
+        throw std::invalid_argument("At least two bin edges are needed to define a bin.");
+    if (!std::is_sorted(edges.begin(), edges.end()))
+        throw std::invalid_argument("The bin edges must be sorted in ascending order.");
+    BinLayout layout;
+    layout.edges = std::move(edges);
+    return layout;
+}
+
+/// Return the number of finite samples and their minimum and maximum (only positive samples are considered if @p positive is true), computed in parallel.
+template <typename S>
+auto samplerange(const S& samples, std::size_t size, bool positive = false) -> std::tuple<std::size_t, double, double>
+{
+    const auto nthreads = numthreads(size);
+    std::vector<std::size_t> counts(nthreads, 0);
+    std::vector<double> mins(nthreads, std::numeric_limits<double>::infinity());
+    std::vector<double> maxs(nthreads, -std::numeric_limits<double>::infinity());
+    parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        auto count = std::size_t(0);
+        auto min = std::numeric_limits<double>::infinity();
+        auto max = -std::numeric_limits<double>::infinity();
+        for (auto i = begin; i < end; ++i)
+        {
+            const auto v = static_cast<double>(samples[i]);
+            if (!std::isfinite(v) || (positive && !(v > 0.0)))
+                continue;
+            count += 1;
+            min = std::min(min, v);
+            max = std::max(max, v);
+        }
+        counts[ithread] = count;
+        mins[ithread] = min;
+        maxs[ithread] = max;
+    });
+    std::size_t count = 0;
+    for (auto c : counts)
+        count += c;
+    return {count, *std::min_element(mins.begin(), mins.end()), *std::max_element(maxs.begin(), maxs.end())};
+}
+
+/// Return the number of bins given by Sturges' rule for @p count samples.
+inline auto sturgesbins(std::size_t count) -> std::size_t
+{
+    return count ? static_cast<std::size_t>(std::ceil(std::log2(static_cast<double>(count)))) + 1 : 1;
+}
+
+/// Return the number of finite samples and their interquartile range (zero if there are fewer than four), found by selection instead of sorting in O(n).
+template <typename S>
+auto interquartilerange(const S& samples, std::size_t size) -> std::pair<std::size_t, double>
+{
+    std::vector<double> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+        if (std::isfinite(static_cast<double>(samples[i])))
+            values.push_back(static_cast<double>(samples[i]));
+    if (values.size() < 4)
+        return {values.size(), 0.0};
+    const auto q1 = values.begin() + values.size() / 4;
+    const auto q3 = values.begin() + (3 * values.size()) / 4;
+    std::nth_element(values.begin(), q3, values.end());
+    std::nth_element(values.begin(), q1, q3);
+    return {values.size(), *q3 - *q1};
+}
+
+/// Return the number of bins given by the Freedman-Diaconis rule for the finite samples spanning [@p min, @p max] (Sturges' rule is used if the interquartile range is zero).
+/// The number is capped, since the range of heavy-tailed samples can be arbitrarily many interquartile ranges wide.
+template <typename S>
+auto freedmandiaconisbins(const S& samples, std::size_t size, double min, double max) -> std::size_t
+{
+    const auto [count, iqr] = interquartilerange(samples, size);
+    if (!(iqr > 0.0))
+        return sturgesbins(count);
+    const auto width = 2.0 * iqr / std::cbrt(static_cast<double>(count));
+    const auto numbins = std::ceil((max - min) / width);
+    const auto maxbins = std::min<double>(count, DEFAULT_HISTOGRAM_MAX_BINS);
+    return static_cast<std::size_t>(std::clamp(numbins, 1.0, std::max(maxbins, 1.0)));
+}
+
+/// Return the sum of the weights of the samples falling into each bin of @p layout, where `weightat(i)` is the weight of sample `i`.
+/// The samples are split among threads, each accumulating its own bins, which are summed at the end.
+template <typename S, typename WeightFn>
+auto bincounts(const S& samples, std::size_t size, const BinLayout& layout, const WeightFn& weightat) -> std::vector<double>
+{
+    const auto numbins = layout.numbins();
+    const auto nthreads = numthreads(size);
+    // Every thread has one extra bin collecting the samples outside all bins, which avoids a branch in the inner loop
+    std::vector<std::vector<double>> partial(nthreads, std::vector<double>(numbins + 1, 0.0));
+    parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        auto& counts = partial[ithread];
+        std::size_t indices[BINNING_BLOCK_SIZE];
+        for (auto b = begin; b < end; b += BINNING_BLOCK_SIZE)
+        {
+            const auto m = std::min<std::size_t>(BINNING_BLOCK_SIZE, end - b);
+            for (std::size_t j = 0; j < m; ++j)
+                indices[j] = layout.index(static_cast<double>(samples[b + j]));
+            for (std::size_t j = 0; j < m; ++j)
+                counts[indices[j]] += static_cast<double>(weightat(b + j));
+        }
+    });
+    auto& counts = partial.front();
+    for (std::size_t t = 1; t < nthreads; ++t)
+        for (std::size_t k = 0; k < numbins; ++k)
+            counts[k] += partial[t][k];
+    counts.pop_back();
+    return counts;
+}
+
+/// Return the sum of the weights of the pairs (@p x, @p y) falling into each bin of the grid @p layoutx by @p layouty, stored row by row (one row per y bin).
+/// The pairs are split among threads as in @ref bincounts.
+template <typename X, typename Y, typename WeightFn>
+auto bincounts2d(const X& x, const Y& y, std::size_t size, const BinLayout& layoutx, const BinLayout& layouty, const WeightFn& weightat) -> std::vector<double>
+{
+    const auto nx = layoutx.numbins();
+    const auto ny = layouty.numbins();
+    const auto nthreads = numthreads(size);
+    // Every thread has one extra column and one extra row collecting the pairs outside all bins, which avoids a branch in the inner loop
+    std::vector<std::vector<double>> partial(nthreads, std::vector<double>((nx + 1) * (ny + 1), 0.0));
+    parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t ithread) {
+        auto& counts = partial[ithread];
+        std::size_t indices[BINNING_BLOCK_SIZE];
+        for (auto b = begin; b < end; b += BINNING_BLOCK_SIZE)
+        {
+            const auto m = std::min<std::size_t>(BINNING_BLOCK_SIZE, end - b);
+            for (std::size_t j = 0; j < m; ++j)
+                indices[j] = layoutx.index(static_cast<double>(x[b + j])) + (nx + 1) * layouty.index(static_cast<double>(y[b + j]));
+            for (std::size_t j = 0; j < m; ++j)
+                counts[indices[j]] += static_cast<double>(weightat(b + j));
+        }
+    });
+    std::vector<double> counts(nx * ny, 0.0);
+    for (std::size_t t = 0; t < nthreads; ++t)
+        for (std::size_t iy = 0; iy < ny; ++iy)
+            for (std::size_t ix = 0; ix < nx; ++ix)
+                counts[ix + nx * iy] += partial[t][ix + (nx + 1) * iy];
+    return counts;
+}
+
+/// Return whether the given @p edges are equally spaced (up to rounding errors), so that the bins can be drawn as the pixels of an image.
+inline auto equallyspaced(const std::vector<double>& edges) -> bool
+{
+    if (edges.size() < 2)
+        return false;
+    const auto width = (edges.back() - edges.front()) / static_cast<double>(edges.size() - 1);
+    for (std::size_t i = 1; i < edges.size(); ++i)
+        if (std::abs(edges[i] - edges[i - 1] - width) > 1e-6 * std::abs(width))
+            return false;
+    return true;
+}
+
+} // namespace internal
+
+/// The class used to specify how samples are divided into the bins of a histogram.
+class Bins
+{
+  public:
+    /// Return bins spanning the range of the samples, their number chosen as the largest given by Sturges' and Freedman-Diaconis' rules (capped for heavy-tailed samples).
+    static auto automatic() -> Bins { return Bins(Kind::Automatic); }
+
+    /// Return bins spanning the range of the samples, their number chosen by Sturges' rule (suited for roughly normal data).
+    static auto sturges() -> Bins { return Bins(Kind::Sturges); }
+
+    /// Return bins spanning the range of the samples, their width chosen by the Freedman-Diaconis rule (robust to outliers, and capped for heavy-tailed samples).
+    static auto freedmanDiaconis() -> Bins { return Bins(Kind::FreedmanDiaconis); }
+
+    /// Return @p numbins bins of equal width spanning the range of the samples.
+    static auto count(std::size_t numbins) -> Bins { return Bins(Kind::Uniform, numbins); }
+
+    /// Return @p numbins bins of equal width spanning [@p min, @p max] (samples outside are ignored).
+    static auto uniform(double min, double max, std::size_t numbins) -> Bins { return Bins(Kind::Uniform, numbins, min, max); }
+
+    /// Return @p numbins bins of equal width in logarithmic scale spanning the range of the positive samples.
+    static auto log(std::size_t numbins) -> Bins { return Bins(Kind::Log, numbins); }
+
+    /// Return @p numbins bins of equal width in logarithmic scale spanning [@p min, @p max] (samples outside are ignored).
+    static auto log(double min, double max, std::size_t numbins) -> Bins { return Bins(Kind::Log, numbins, min, max); }
+
+    /// Return bins with the given @p edges, sorted in ascending order (samples outside are ignored).
+    static auto edges(std::vector<double> edges) -> Bins
+    {
+        Bins bins(Kind::Explicit);
+        bins.m_edges = std::move(edges);
+        return bins;
+    }
+
+    /// Return the layout of these bins for the first @p size entries of @p samples.
+    template <typename S>
+    auto layout(const S& samples, std::size_t size) const -> internal::BinLayout;
+
+  private:
+    friend class Histogram;
+
+    /// The ways in which the bins can be specified.
+    enum class Kind
+    {
+        Automatic,
+        Sturges,
+        FreedmanDiaconis,
+        Uniform,
+        Log,
+        Explicit
+    };
+
+    /// Construct a Bins object of the given kind.
+    Bins(Kind kind, std::size_t numbins = 0, double min = NaN, double max = NaN)
+        : m_kind(kind), m_numbins(numbins), m_min(min), m_max(max) {}
+
+    /// The way in which the bins are specified.
+    Kind m_kind;
+
+    /// The number of bins (zero if it is determined from the samples).
+    std::size_t m_numbins = 0;
+
+    /// The lower end of the binned range (NaN if it is determined from the samples).
+    double m_min = NaN;
+
+    /// The upper end of the binned range (NaN if it is determined from the samples).
+    double m_max = NaN;
+
+    /// The explicitly given bin edges.
+    std::vector<double> m_edges;
+};
+
+template <typename S>
+auto Bins::layout(const S& samples, std::size_t size) const -> internal::BinLayout
+{
+    if (m_kind == Kind::Explicit)
+        return internal::explicitlayout(m_edges);
+
+    const auto hasrange = std::isfinite(m_min) && std::isfinite(m_max);
+    auto [count, min, max] = internal::samplerange(samples, hasrange ? 0 : size, m_kind == Kind::Log);
+    if (hasrange)
+    {
+        min = m_min;
+        max = m_max;
+    }
+    else if (count == 0)
+    {
+        // There are no (positive) finite samples, so any range will do
+        min = m_kind == Kind::Log ? 1.0 : 0.0;
+        max = m_kind == Kind::Log ? 10.0 : 1.0;
+    }
+
+    switch (m_kind)
+    {
+    case Kind::Log:
+        return internal::loglayout(min, max, m_numbins);
+    case Kind::Uniform:
+        return internal::uniformlayout(min, max, m_numbins);
+    case Kind::Sturges:
+        return internal::uniformlayout(min, max, internal::sturgesbins(count));
+    case Kind::FreedmanDiaconis:
+        return internal::uniformlayout(min, max, internal::freedmandiaconisbins(samples, size, min, max));
+    default:
+        return internal::uniformlayout(min, max, std::max(internal::sturgesbins(count), internal::freedmandiaconisbins(samples, size, min, max)));
+    }
+}
+
+namespace internal
+{
+
+/// Return the layout and the weighted counts of the bins of @p samples, where `weightat(i)` is the weight of sample `i`.
+template <typename S, typename WeightFn>
+auto histogram(const S& samples, std::size_t size, const Bins& bins, const WeightFn& weightat) -> std::pair<BinLayout, std::vector<double>>
+{
+    auto layout = bins.layout(samples, size);
+    auto counts = bincounts(samples, size, layout, weightat);
+    return {std::move(layout), std::move(counts)};
+}
+
+/// Return the layouts along x and y and the weighted counts (row by row) of the bins of the pairs (@p x, @p y), where `weightat(i)` is the weight of pair `i`.
+template <typename X, typename Y, typename WeightFn>
+auto histogram2d(const X& x, const Y& y, std::size_t size, const Bins& binsx, const Bins& binsy, const WeightFn& weightat) -> std::tuple<BinLayout, BinLayout, std::vector<double>>
+{
+    auto layoutx = binsx.layout(x, size);
+    auto layouty = binsy.layout(y, size);
+    auto counts = bincounts2d(x, y, size, layoutx, layouty, weightat);
+    return {std::move(layoutx), std::move(layouty), std::move(counts)};
+}
+
+} // namespace internal
+
+/// The class used to accumulate a histogram of samples arriving in batches, with a memory footprint proportional to the number of bins.
+/// Histograms filled on different threads can be combined with @ref merge, so each thread can fill its own without locking.
+///
+/// The bins are either fixed (`Bins::uniform`, `Bins::log` with a range, or `Bins::edges`), in which case samples outside them are ignored,
+/// or adaptive (`Bins::count`, `Bins::log` without a range), in which case the given number of bins is kept and their width doubles
+/// whenever needed to cover new samples. Adaptive bins have power-of-two widths aligned to multiples of their width
+/// (in the base-2 logarithm of the values for logarithmic bins), so that any two adaptive histograms can be merged exactly.
+class Histogram
+{
+  public:
+    /// Construct a Histogram object with given @p bins.
+    explicit Histogram(const Bins& bins);
+
+    /// Add the given batch of @p samples to the histogram.
+    template <typename S>
+    auto add(const S& samples) -> Histogram&;
+
+    /// Add the given batch of @p samples with given @p weights to the histogram.
+    template <typename S, typename W>
+    auto add(const S& samples, const W& weights) -> Histogram&;
+
+    /// Add the counts of another histogram with the same kind of bins to this one.
+    auto merge(const Histogram& other) -> Histogram&;
+
+    /// Return the number of bins.
+    auto numbins() const -> std::size_t { return m_counts.size(); }
+
+    /// Return the edges of the bins (one more than the number of bins).
+    auto edges() const -> std::vector<double> { return layout().edges; }
+
+    /// Return the sum of the weights of the samples in each bin.
+    auto counts() const -> const std::vector<double>& { return m_counts; }
+
+    /// Return the sum of the weights of all samples in the bins.
+    auto total() const -> double;
+
+  private:
+    /// Return the current layout of the bins.
+    auto layout() const -> internal::BinLayout;
+
+    /// Extend the adaptive bins so that they cover values between @p min and @p max (in grid units, i.e., base-2 logarithms for logarithmic bins) with a width of at least 2^@p minexponent.
+    auto cover(double min, double max, int minexponent = std::numeric_limits<int>::min()) -> void;
+
+    /// Add the count @p count of the adaptive bin at position @p position (in multiples of 2^@p exponent) to the bin containing it.
+    auto addbin(long long position, int exponent, double count) -> void;
+
+    /// Add the samples of a batch, where `weightat(i)` is the weight of sample `i`.
+    template <typename S, typename WeightFn>
+    auto addwith(const S& samples, std::size_t size, const WeightFn& weightat) -> Histogram&;
+
+    /// The layout of the bins if they are fixed.
+    internal::BinLayout m_fixed;
+
+    /// Whether the bins are adaptive.
+    bool m_adaptive = false;
+
+    /// Whether the bins are equally spaced in logarithmic scale.
+    bool m_logarithmic = false;
+
+    /// Whether any sample has been added to the adaptive bins, which are positioned by the first batch.
+    bool m_started = false;
+
+    /// The base-2 exponent of the width of the adaptive bins.
+    int m_exponent = 0;
+
+    /// The position of the first adaptive bin in multiples of the bin width.
+    long long m_offset = 0;
+
+    /// The smallest value covered by the adaptive bins so far (in grid units).
+    double m_min = 0.0;
+
+    /// The largest value covered by the adaptive bins so far (in grid units).
+    double m_max = 0.0;
+
+    /// The sum of the weights of the samples in each bin.
+    std::vector<double> m_counts;
+};
+
+namespace internal
+{
+
+/// Return the integer division of @p a by @p b rounded towards negative infinity.
+inline auto floordiv(long long a, long long b) -> long long
+{
+    const auto q = a / b;
+    return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+} // namespace internal
+
+inline Histogram::Histogram(const Bins& bins)
+{
+    const auto hasrange = std::isfinite(bins.m_min) && std::isfinite(bins.m_max);
+    switch (bins.m_kind)
+    {
+    case Bins::Kind::Explicit:
+        m_fixed = internal::explicitlayout(bins.m_edges);
+        break;
+    case Bins::Kind::Uniform:
+    case Bins::Kind::Log:
+        if (hasrange)
+        {
+            m_fixed = bins.m_kind == Bins::Kind::Log ? internal::loglayout(bins.m_min, bins.m_max, bins.m_numbins) : internal::uniformlayout(bins.m_min, bins.m_max, bins.m_numbins);
+            break;
+        }
+        m_adaptive = true;
+        m_logarithmic = bins.m_kind == Bins::Kind::Log;
+        m_counts.assign(std::max<std::size_t>(bins.m_numbins, 1), 0.0);
+        return;
+    default:
+        throw std::invalid_argument("A streaming histogram needs a fixed number of bins (use Bins::count, Bins::uniform, Bins::log or Bins::edges).");
+    }
+    m_counts.assign(m_fixed.numbins(), 0.0);
+}
+
+inline auto Histogram::layout() const -> internal::BinLayout
+{
+    if (!m_adaptive)
+        return m_fixed;
+    const auto width = std::ldexp(1.0, m_exponent);
+    const auto first = m_offset * width;
+    const auto last = (m_offset + static_cast<long long>(numbins())) * width;
+    if (m_logarithmic)
+        return internal::loglayout(std::exp2(first), std::exp2(last), numbins());
+    return internal::uniformlayout(first, last, numbins());
+}
+
+inline auto Histogram::addbin(long long position, int exponent, double count) -> void
+{
+    const auto shift = std::min(m_exponent - exponent, 62);
+    const auto j = internal::floordiv(position, 1LL << shift) - m_offset;
+    m_counts[std::clamp<long long>(j, 0, static_cast<long long>(numbins()) - 1)] += count;
+}
+
+inline auto Histogram::cover(double min, double max, int minexponent) -> void
+{
+    if (!m_started)
+    {
+        // Start from the finest power-of-two width able to cover the first batch
+        const auto range = max - min;
+        const auto magnitude = std::max(std::abs(min), std::abs(max));
+        m_exponent = range > 0.0 ? std::ilogb(range / numbins()) : (magnitude > 0.0 ? std::ilogb(magnitude) - 20 : -30);
+        m_min = min;
+        m_max = max;
+    }
+    min = std::min(min, m_min);
+    max = std::max(max, m_max);
+
+    // Double the width until all values fit into the bins
+    const auto n = static_cast<long long>(numbins());
+    auto exponent = std::max(m_exponent, minexponent);
+    auto offset = static_cast<long long>(std::floor(std::ldexp(min, -exponent)));
+    while (static_cast<long long>(std::floor(std::ldexp(max, -exponent))) - offset >= n)
+    {
+        exponent += 1;
+        offset = static_cast<long long>(std::floor(std::ldexp(min, -exponent)));
+    }
+
+    if (m_started && (exponent != m_exponent || offset != m_offset))
+    {
+        // Move the counts into the new bins, which are unions of the old ones since all widths are powers of two
+        const auto counts = std::exchange(m_counts, std::vector<double>(m_counts.size(), 0.0));
+        const auto oldexponent = std::exchange(m_exponent, exponent);
+        const auto oldoffset = std::exchange(m_offset, offset);
+        for (long long i = 0; i < n; ++i)
+            if (counts[i] != 0.0)
+                addbin(oldoffset + i, oldexponent, counts[i]);
+    }
+
+    m_exponent = exponent;
+    m_offset = offset;
+    m_min = min;
+    m_max = max;
+    m_started = true;
+}
+
+template <typename S, typename WeightFn>
+auto Histogram::addwith(const S& samples, std::size_t size, const WeightFn& weightat) -> Histogram&
+{
+    if (m_adaptive)
+    {
+        const auto [count, min, max] = internal::samplerange(samples, size, m_logarithmic);
+        if (count == 0)
+            return *this;
+        if (m_logarithmic)
+            cover(std::log2(min), std::log2(max));
+        else
+            cover(min, max);
+    }
+    const auto counts = internal::bincounts(samples, size, layout(), weightat);
+    for (std::size_t k = 0; k < counts.size(); ++k)
+        m_counts[k] += counts[k];
+    return *this;
+}
+
+template <typename S>
+auto Histogram::add(const S& samples) -> Histogram&
+{
+    return addwith(samples, internal::minsize(samples), [](std::size_t) { return 1.0; });
+}
+
+template <typename S, typename W>
+auto Histogram::add(const S& samples, const W& weights) -> Histogram&
+{
+    return addwith(samples, internal::minsize(samples, weights), [&](std::size_t i) { return weights[i]; });
+}
+
+inline auto Histogram::merge(const Histogram& other) -> Histogram&
+{
+    if (m_adaptive != other.m_adaptive || m_logarithmic != other.m_logarithmic || numbins() != other.numbins())
+        throw std::invalid_argument("Only histograms with the same kind and number of bins can be merged.");
+    if (!m_adaptive)
+    {
+        if (m_fixed.edges != other.m_fixed.edges)
+            throw std::invalid_argument("Only histograms with the same bin edges can be merged.");
+        for (std::size_t k = 0; k < m_counts.size(); ++k)
+            m_counts[k] += other.m_counts[k];
+        return *this;
+    }
+    if (!other.m_started)
+        return *this;
+    if (!m_started)
+        return *this = other;
+    // Coarsen the bins to cover the values of both histograms at no finer width than either, then move the other counts over
+    cover(other.m_min, other.m_max, other.m_exponent);
+    for (std::size_t i = 0; i < other.numbins(); ++i)
+        if (other.m_counts[i] != 0.0)
+            addbin(other.m_offset + static_cast<long long>(i), other.m_exponent, other.m_counts[i]);
+    return *this;
+}
+
+inline auto Histogram::total() const -> double
+{
+    auto sum = 0.0;
+    for (auto c : m_counts)
+        sum += c;
+    return sum;
+}
+
+} // namespace sciplot
@@ -0,0 +1,241 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <array>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Contour.hpp>
+#include <sciplot/Parallel.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The number of layers of grid cells traced together as one slab, the unit of work shared among threads.
+const auto ISOSURFACE_SLAB_LAYERS = 16;
+
+/// A mesh of triangles sharing their vertices.
+struct TriangleMesh
+{
+    std::vector<double> x;                ///< The x coordinates of the vertices
+    std::vector<double> y;                ///< The y coordinates of the vertices
+    std::vector<double> z;                ///< The z coordinates of the vertices
+    std::vector<std::size_t> triangles;   ///< The indices of the three vertices of every triangle, one triangle after the other
+
+    /// Return the number of triangles.
+    auto numtriangles() const -> std::size_t { return triangles.size() / 3; }
+};
+
+/// The corners of a cube joined by each of its 12 edges, with corner c at offsets (c & 1, (c >> 1) & 1, (c >> 2) & 1) along x, y, and z.
+/// Edges 0 to 3 run along x, edges 4 to 7 along y, and edges 8 to 11 along z, each from its first corner.
+const int CUBE_EDGES[12][2] = {{0, 1}, {2, 3}, {4, 5}, {6, 7}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
+
+/// The corners of the 6 faces of a cube, in cyclic order.
+const int CUBE_FACES[6][4] = {{0, 2, 6, 4}, {1, 3, 7, 5}, {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 1, 3, 2}, {4, 5, 7, 6}};
+
+/// The triangles (as triples of cube edges) of the isosurface crossing a cube, for every configuration of its corners at or above the isovalue.
+using MarchingCubesTable = std::array<std::vector<std::array<int, 3>>, 256>;
+
+/// Return the marching cubes table, built on first use rather than spelled out.
+/// Every face of a configuration is traced with marching squares (see @ref MARCHING_SQUARES_SEGMENTS), whose saddles depend only on the corners of the face,
+/// so that the two cubes sharing a face always cut it along the same segments and the surface has no cracks. The segments of the 6 faces form closed polygons
+/// (every crossed edge is shared by two faces), which are split into triangles around their first vertex.
+inline auto marchingcubestable() -> const MarchingCubesTable&
+{
+    static const MarchingCubesTable table = [] {
+        const auto edgeof = [](int a, int b) {
+            for (int e = 0; e < 12; ++e)
+                if ((CUBE_EDGES[e][0] == a && CUBE_EDGES[e][1] == b) || (CUBE_EDGES[e][0] == b && CUBE_EDGES[e][1] == a))
+                    return e;
+            return -1;
+        };
+        MarchingCubesTable result;
+        for (int config = 0; config < 256; ++config)
+        {
+            std::vector<std::array<int, 2>> segments;
+            for (const auto& face : CUBE_FACES)
+            {
+                int faceconfig = 0;
+                for (int k = 0; k < 4; ++k)
+                    faceconfig |= ((config >> face[k]) & 1) << k;
+                const auto& pairs = MARCHING_SQUARES_SEGMENTS[faceconfig];
+                for (int k = 0; k < 4 && pairs[k] >= 0; k += 2)
+                    segments.push_back({edgeof(face[pairs[k]], face[(pairs[k] + 1) % 4]), edgeof(face[pairs[k + 1]], face[(pairs[k + 1] + 1) % 4])});
+            }
+            std::vector<char> used(segments.size(), 0);
+            for (std::size_t s = 0; s < segments.size(); ++s)
+            {
+                if (used[s])
+                    continue;
+                used[s] = 1;
+                std::vector<int> polygon = {segments[s][0]};
+                auto edge = segments[s][1];
+                while (edge != polygon.front())
+                {
+                    polygon.push_back(edge);
+                    for (std::size_t t = 0; t < segments.size(); ++t)
+                    {
+                        if (!used[t] && (segments[t][0] == edge || segments[t][1] == edge))
+                        {
+                            used[t] = 1;
+                            edge = segments[t][0] == edge ? segments[t][1] : segments[t][0];
+                            break;
+                        }
+                    }
+                }
+                for (std::size_t m = 1; m + 1 < polygon.size(); ++m)
+                    result[config].push_back({polygon[0], polygon[m], polygon[m + 1]});
+            }
+        }
+        return result;
+    }();
+    return table;
+}
+
+/// The part of an isosurface extracted from one slab of grid cells, with the vertices identified by the grid edges they lie on.
+/// The edge along axis a (0 for x, 1 for y, 2 for z) from node (k, j, i) of a grid of nx by ny nodes per layer has index 3 * ((k * ny + j) * nx + i) + a.
+struct IsosurfaceSlab
+{
+    TriangleMesh mesh;                                      ///< The triangles of the slab, with vertices indexed within the slab
+    std::vector<std::size_t> edges;                         ///< The grid edge of every vertex of the slab
+    std::unordered_map<std::size_t, std::size_t> vertexat;  ///< The vertex of the slab on every grid edge crossed by the surface
+};
+
+/// Return the triangles of the isosurface at @p isovalue crossing the cells between node layers @p kbegin and @p kend of the grid of @p nx by @p ny by @p nz nodes
+/// with values `valueat(k, j, i)` at (@p x[i], @p y[j], @p z[k]). Cells with a non-finite corner are skipped.
+template <typename X, typename Y, typename Z, typename ValueFn>
+auto marchingcubes(const X& x, const Y& y, const Z& z, std::size_t nx, std::size_t ny, const ValueFn& valueat, double isovalue, std::size_t kbegin, std::size_t kend) -> IsosurfaceSlab
+{
+    const auto& table = marchingcubestable();
+    IsosurfaceSlab slab;
+    const auto vertexon = [&](std::size_t k, std::size_t j, std::size_t i, int axis) {
+        const auto edge = 3 * ((k * ny + j) * nx + i) + axis;
+        const auto [it, inserted] = slab.vertexat.emplace(edge, slab.edges.size());
+        if (inserted)
+        {
+            const auto k1 = k + (axis == 2);
+            const auto j1 = j + (axis == 1);
+            const auto i1 = i + (axis == 0);
+            const double v0 = valueat(k, j, i);
+            const double v1 = valueat(k1, j1, i1);
+            const auto t = v1 != v0 ? (isovalue - v0) / (v1 - v0) : 0.5;
+            slab.mesh.x.push_back(static_cast<double>(x[i]) + t * (static_cast<double>(x[i1]) - static_cast<double>(x[i])));
+            slab.mesh.y.push_back(static_cast<double>(y[j]) + t * (static_cast<double>(y[j1]) - static_cast<double>(y[j])));
+            slab.mesh.z.push_back(static_cast<double>(z[k]) + t * (static_cast<double>(z[k1]) - static_cast<double>(z[k])));
+            slab.edges.push_back(edge);
+        }
+        return it->second;
+    };
+    for (auto k = kbegin; k < kend; ++k)
+    {
+        for (std::size_t j = 0; j + 1 < ny; ++j)
+        {
+            for (std::size_t i = 0; i + 1 < nx; ++i)
+            {
+                int config = 0;
+                auto finite = true;
+                for (int c = 0; c < 8; ++c)
+                {
+                    const double v = valueat(k + ((c >> 2) & 1), j + ((c >> 1) & 1), i + (c & 1));
+                    finite = finite && std::isfinite(v);
+                    config |= (v >= isovalue) << c;
+                }
+                if (!finite || table[config].empty())
+                    continue;
+                for (const auto& triangle : table[config])
+                {
+                    for (const auto e : triangle)
+                    {
+                        const auto corner = CUBE_EDGES[e][0];
+                        slab.mesh.triangles.push_back(vertexon(k + ((corner >> 2) & 1), j + ((corner >> 1) & 1), i + (corner & 1), e / 4));
+                    }
+                }
+            }
+        }
+    }
+    return slab;
+}
+
+/// Return the isosurface at @p isovalue of the field with values `valueat(k, j, i)` at the nodes (@p x[i], @p y[j], @p z[k]) of a grid of @p nx by @p ny by @p nz nodes.
+/// Slabs of @ref ISOSURFACE_SLAB_LAYERS layers of cells are traced with marching cubes in parallel, each sharing the vertices of its triangles through a hash map of the grid edges
+/// they lie on. The slabs are then joined, with the vertices on the layer between two slabs merged, so that every vertex appears once and the memory used is proportional
+/// to the surface rather than to the volume.
+template <typename X, typename Y, typename Z, typename ValueFn>
+auto isosurface(const X& x, const Y& y, const Z& z, std::size_t nx, std::size_t ny, std::size_t nz, const ValueFn& valueat, double isovalue) -> TriangleMesh
+{
+    TriangleMesh mesh;
+    if (nx < 2 || ny < 2 || nz < 2)
+        return mesh;
+
+    const auto numslabs = (nz - 1 + ISOSURFACE_SLAB_LAYERS - 1) / ISOSURFACE_SLAB_LAYERS;
+    std::vector<IsosurfaceSlab> slabs(numslabs);
+    parallelfor(numslabs, std::min(numthreads(nx * ny * nz), numslabs), [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (auto s = begin; s < end; ++s)
+            slabs[s] = marchingcubes(x, y, z, nx, ny, valueat, isovalue, s * ISOSURFACE_SLAB_LAYERS, std::min<std::size_t>((s + 1) * ISOSURFACE_SLAB_LAYERS, nz - 1));
+    });
+
+    // Renumber the vertices of every slab, reusing those of the previous slab on the layer of nodes they share (the edges along x and y of its first layer)
+    const auto none = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> previous, current;
+    for (std::size_t s = 0; s < numslabs; ++s)
+    {
+        auto& slab = slabs[s];
+        const auto sharedend = 3 * (s * ISOSURFACE_SLAB_LAYERS + 1) * nx * ny;
+        current.assign(slab.edges.size(), none);
+        for (std::size_t v = 0; v < slab.edges.size(); ++v)
+        {
+            if (s > 0 && slab.edges[v] < sharedend && slab.edges[v] % 3 != 2)
+            {
+                const auto it = slabs[s - 1].vertexat.find(slab.edges[v]);
+                if (it != slabs[s - 1].vertexat.end())
+                {
+                    current[v] = previous[it->second];
+                    continue;
+                }
+            }
+            current[v] = mesh.x.size();
+            mesh.x.push_back(slab.mesh.x[v]);
+            mesh.y.push_back(slab.mesh.y[v]);
+            mesh.z.push_back(slab.mesh.z[v]);
+        }
+        for (const auto v : slab.mesh.triangles)
+            mesh.triangles.push_back(current[v]);
+        if (s > 0)
+            slabs[s - 1] = IsosurfaceSlab();
+        std::swap(previous, current);
+    }
+    return mesh;
+}
+
+} // namespace internal
+} // namespace sciplot
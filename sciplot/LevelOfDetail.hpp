@@ -0,0 +1,318 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Utils.hpp>
+
+namespace sciplot
+{
+
+/// The x and y vectors of a curve reduced to a given plot resolution.
+struct CurveData
+{
+    std::vector<double> x; ///< The *x* values of the reduced curve
+    std::vector<double> y; ///< The *y* values of the reduced curve
+};
+
+/// The class used to store a long curve as a multi-resolution pyramid of min/max envelopes.
+/// The pyramid is built once in O(n) and then answers queries for any *x* window at any width
+/// in O(width log n), returning the original points that are visible at that resolution.
+/// @note The *x* values are expected to be sorted in ascending order.
+class LevelOfDetail
+{
+  public:
+    /// Construct an empty LevelOfDetail object.
+    LevelOfDetail() = default;
+
+    /// Construct a LevelOfDetail object with given @p x and @p y vectors.
+    template <typename X, typename Y>
+    LevelOfDetail(const X& x, const Y& y);
+
+    /// Return the number of points in the original curve.
+    auto size() const -> std::size_t { return m_x.size(); }
+
+    /// Return the number of levels in the pyramid above the original points (the k-th of them, counting from zero, holds blocks of 2^(k+1) points).
+    auto levels() const -> std::size_t { return m_argmin.size(); }
+
+    /// Return the smallest *x* value of the curve.
+    auto xmin() const -> double { return m_x.empty() ? NaN : m_x.front(); }
+
+    /// Return the largest *x* value of the curve.
+    auto xmax() const -> double { return m_x.empty() ? NaN : m_x.back(); }
+
+    /// Return the points of the curve within [@p x0, @p x1] reduced to @p width pixel columns.
+    /// For each column, the first, last, lowest and highest points are returned in their original order, which draws identically to the full curve at that resolution.
+    auto query(double x0, double x1, std::size_t width) const -> CurveData;
+
+    /// Return the whole curve reduced to @p width pixel columns.
+    auto query(std::size_t width) const -> CurveData { return query(xmin(), xmax(), width); }
+
+    /// Save the pyramid to a binary file so that it can be loaded later without being rebuilt.
+    auto save(const std::string& filename) const -> void;
+
+    /// Load a pyramid previously saved with @ref save.
+    /// @throws std::runtime_error if the file cannot be read, was not written by @ref save on a machine with the same byte order, or is truncated or corrupted.
+    static auto load(const std::string& filename) -> LevelOfDetail;
+
+  private:
+    /// The tag saved after the file signature, which reads differently on machines with a different byte order.
+    static constexpr std::uint32_t byteordermark = 0x01020304;
+
+    /// Build all levels of the pyramid from the stored curve.
+    auto build() -> void;
+
+    /// Return the index of the lower (@p lowest == true) or higher y value among points @p i and @p j, preferring finite values.
+    auto pick(std::size_t i, std::size_t j, bool lowest) const -> std::size_t;
+
+    /// Return the index of the lowest (@p lowest == true) or highest point in block @p j of @p level (level 0 being the points themselves).
+    auto blockarg(std::size_t level, std::size_t j, bool lowest) const -> std::size_t;
+
+    /// Return the indices of the lowest and highest points in the index range [@p begin, @p end).
+    auto rangeargminmax(std::size_t begin, std::size_t end) const -> std::pair<std::size_t, std::size_t>;
+
+    /// The *x* values of the original curve.
+    std::vector<double> m_x;
+
+    /// The *y* values of the original curve.
+    std::vector<double> m_y;
+
+    /// The index of the lowest point in each aligned block of each level.
+    std::vector<std::vector<std::size_t>> m_argmin;
+
+    /// The index of the highest point in each aligned block of each level.
+    std::vector<std::vector<std::size_t>> m_argmax;
+};
+
+template <typename X, typename Y>
+LevelOfDetail::LevelOfDetail(const X& x, const Y& y)
+{
+    const auto size = internal::minsize(x, y);
+    m_x.resize(size);
+    m_y.resize(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        m_x[i] = static_cast<double>(x[i]);
+        m_y[i] = static_cast<double>(y[i]);
+    }
+    build();
+}
+
+inline auto LevelOfDetail::pick(std::size_t i, std::size_t j, bool lowest) const -> std::size_t
+{
+    if (std::isnan(m_y[i]))
+        return j;
+    if (std::isnan(m_y[j]))
+        return i;
+    if (lowest)
+        return m_y[j] < m_y[i] ? j : i;
+    return m_y[j] > m_y[i] ? j : i;
+}
+
+inline auto LevelOfDetail::blockarg(std::size_t level, std::size_t j, bool lowest) const -> std::size_t
+{
+    if (level == 0)
+        return j;
+    return lowest ? m_argmin[level - 1][j] : m_argmax[level - 1][j];
+}
+
+inline auto LevelOfDetail::build() -> void
+{
+    m_argmin.clear();
+    m_argmax.clear();
+    // Every level merges pairs of aligned blocks of the level below, so that level k holds floor(n / 2^k) blocks
+    for (auto numblocks = m_x.size() / 2; numblocks > 0; numblocks /= 2)
+    {
+        const auto level = m_argmin.size(); // the level below the one being built
+        std::vector<std::size_t> argmin(numblocks);
+        std::vector<std::size_t> argmax(numblocks);
+        for (std::size_t j = 0; j < numblocks; ++j)
+        {
+            argmin[j] = pick(blockarg(level, 2 * j, true), blockarg(level, 2 * j + 1, true), true);
+            argmax[j] = pick(blockarg(level, 2 * j, false), blockarg(level, 2 * j + 1, false), false);
+        }
+        m_argmin.push_back(std::move(argmin));
+        m_argmax.push_back(std::move(argmax));
+    }
+}
+
+inline auto LevelOfDetail::rangeargminmax(std::size_t begin, std::size_t end) const -> std::pair<std::size_t, std::size_t>
+{
+    auto imin = begin;
+    auto imax = begin;
+    // Walk up the pyramid taking the unpaired blocks at both ends of the range on each level (as in an iterative segment tree)
+    for (std::size_t level = 0; begin < end; ++level, begin /= 2, end /= 2)
+    {
+        if (begin & 1)
+        {
+            imin = pick(imin, blockarg(level, begin, true), true);
+            imax = pick(imax, blockarg(level, begin, false), false);
+            ++begin;
+        }
+        if (end & 1)
+        {
+            --end;
+            imin = pick(imin, blockarg(level, end, true), true);
+            imax = pick(imax, blockarg(level, end, false), false);
+        }
+    }
+    return {imin, imax};
+}
+
+inline auto LevelOfDetail::query(double x0, double x1, std::size_t width) const -> CurveData
+{
+    CurveData result;
+    if (m_x.empty() || width == 0 || !(x1 >= x0))
+        return result;
+
+    auto ibegin = static_cast<std::size_t>(std::lower_bound(m_x.begin(), m_x.end(), x0) - m_x.begin());
+    auto iend = static_cast<std::size_t>(std::upper_bound(m_x.begin(), m_x.end(), x1) - m_x.begin());
+
+    // Keep the neighbor points just outside the window so that the curve reaches its edges
+    const auto first = ibegin > 0 ? ibegin - 1 : ibegin;
+    const auto last = iend < m_x.size() ? iend + 1 : iend;
+
+    std::vector<std::size_t> indices;
+    indices.reserve(4 * width + 2);
+    if (first < ibegin)
+        indices.push_back(first);
+
+    const auto dx = (x1 - x0) / static_cast<double>(width);
+    auto begin = ibegin;
+    for (std::size_t c = 0; c < width && begin < iend; ++c)
+    {
+        // The points of column c are those with x in [x0 + c*dx, x0 + (c+1)*dx), the last column being closed
+        const auto end = c + 1 == width ? iend : std::max(begin, static_cast<std::size_t>(std::lower_bound(m_x.begin() + begin, m_x.begin() + iend, x0 + (c + 1) * dx) - m_x.begin()));
+        if (begin == end)
+            continue;
+        const auto [imin, imax] = rangeargminmax(begin, end);
+        std::size_t column[4] = {begin, imin, imax, end - 1};
+        std::sort(column, column + 4);
+        for (auto i : column)
+            if (indices.empty() || indices.back() != i)
+                indices.push_back(i);
+        begin = end;
+    }
+
+    if (last > iend)
+        indices.push_back(iend);
+
+    result.x.reserve(indices.size());
+    result.y.reserve(indices.size());
+    for (auto i : indices)
+    {
+        result.x.push_back(m_x[i]);
+        result.y.push_back(m_y[i]);
+    }
+    return result;
+}
+
+inline auto LevelOfDetail::save(const std::string& filename) const -> void
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("Could not open file '" + filename + "' for writing the level of detail pyramid.");
+    const std::uint64_t size = m_x.size();
+    file.write("SCIPLOTLOD1", 11);
+    file.write(reinterpret_cast<const char*>(&byteordermark), sizeof(byteordermark));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(m_x.data()), size * sizeof(double));
+    file.write(reinterpret_cast<const char*>(m_y.data()), size * sizeof(double));
+    for (std::size_t level = 0; level < m_argmin.size(); ++level)
+    {
+        for (const auto* args : {&m_argmin[level], &m_argmax[level]})
+        {
+            const std::vector<std::uint64_t> values(args->begin(), args->end());
+            file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(std::uint64_t));
+        }
+    }
+    if (!file)
+        throw std::runtime_error("Could not write the level of detail pyramid to file '" + filename + "'.");
+}
+
+inline auto LevelOfDetail::load(const std::string& filename) -> LevelOfDetail
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file)
+        throw std::runtime_error("Could not open file '" + filename + "' for reading the level of detail pyramid.");
+    const auto length = static_cast<std::uint64_t>(file.tellg());
+    file.seekg(0);
+
+    char magic[11] = {};
+    std::uint32_t mark = 0;
+    std::uint64_t size = 0;
+    file.read(magic, 11);
+    file.read(reinterpret_cast<char*>(&mark), sizeof(mark));
+    file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!file || std::string(magic, 11) != "SCIPLOTLOD1")
+        throw std::runtime_error("The file '" + filename + "' does not contain a level of detail pyramid.");
+    if (mark != byteordermark)
+        throw std::runtime_error("The level of detail pyramid in file '" + filename + "' was saved on a machine with a different byte order.");
+
+    // Check the size in the header against the file length before allocating anything, since x, y and each level take 16 bytes per point or block
+    const std::uint64_t header = 11 + sizeof(mark) + sizeof(size);
+    if (size > (length - header) / 16)
+        throw std::runtime_error("The level of detail pyramid in file '" + filename + "' is truncated.");
+    auto expected = header + 16 * size;
+    for (auto numblocks = size / 2; numblocks > 0; numblocks /= 2)
+        expected += 16 * numblocks;
+    if (length != expected)
+        throw std::runtime_error("The level of detail pyramid in file '" + filename + "' is " + (length < expected ? "truncated." : "followed by unexpected data."));
+
+    LevelOfDetail lod;
+    lod.m_x.resize(size);
+    lod.m_y.resize(size);
+    file.read(reinterpret_cast<char*>(lod.m_x.data()), size * sizeof(double));
+    file.read(reinterpret_cast<char*>(lod.m_y.data()), size * sizeof(double));
+    std::uint64_t blocksize = 2;
+    for (auto numblocks = size / 2; numblocks > 0; numblocks /= 2, blocksize *= 2)
+    {
+        for (auto* args : {&lod.m_argmin, &lod.m_argmax})
+        {
+            std::vector<std::uint64_t> values(numblocks);
+            file.read(reinterpret_cast<char*>(values.data()), numblocks * sizeof(std::uint64_t));
+            // Every index must point into its own block, otherwise queries would read outside the curve
+            for (std::uint64_t j = 0; j < numblocks; ++j)
+                if (values[j] / blocksize != j)
+                    throw std::runtime_error("The level of detail pyramid in file '" + filename + "' is corrupted.");
+            args->emplace_back(values.begin(), values.end());
+        }
+    }
+    if (!file)
+        throw std::runtime_error("The level of detail pyramid in file '" + filename + "' is truncated.");
+    return lod;
+}
+
+} // namespace sciplot
@@ -0,0 +1,80 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace sciplot
+{
+
+/// The class used to pass a matrix of values stored with arbitrary strides (e.g., a slice or a transposed view of a larger array) without copying it.
+class MatrixView
+{
+  public:
+    /// Construct a MatrixView object for the contiguous matrix of @p rows rows and @p cols columns stored row after row at @p data.
+    MatrixView(const double* data, std::size_t rows, std::size_t cols)
+        : MatrixView(data, rows, cols, static_cast<std::ptrdiff_t>(cols), 1) {}
+
+    /// Construct a MatrixView object for the matrix of @p rows rows and @p cols columns whose entry (i, j) is at `data[i * rowstride + j * colstride]`.
+    MatrixView(const double* data, std::size_t rows, std::size_t cols, std::ptrdiff_t rowstride, std::ptrdiff_t colstride)
+        : m_data(data), m_rows(rows), m_cols(cols), m_rowstride(rowstride), m_colstride(colstride) {}
+
+    /// Construct a MatrixView object for the contiguous matrix of @p rows rows stored row after row in @p values.
+    MatrixView(const std::vector<double>& values, std::size_t rows)
+        : MatrixView(values.data(), rows, rows ? values.size() / rows : 0) {}
+
+    /// Return the entry at row @p i and column @p j.
+    auto operator()(std::size_t i, std::size_t j) const -> double { return m_data[static_cast<std::ptrdiff_t>(i) * m_rowstride + static_cast<std::ptrdiff_t>(j) * m_colstride]; }
+
+    /// Return the number of rows.
+    auto rows() const -> std::size_t { return m_rows; }
+
+    /// Return the number of columns.
+    auto cols() const -> std::size_t { return m_cols; }
+
+    /// Return a view of the transpose of this matrix, sharing its values.
+    auto transposed() const -> MatrixView { return MatrixView(m_data, m_cols, m_rows, m_colstride, m_rowstride); }
+
+  private:
+    /// The address of the entry at row 0 and column 0.
+    const double* m_data;
+
+    /// The number of rows.
+    std::size_t m_rows;
+
+    /// The number of columns.
+    std::size_t m_cols;
+
+    /// The distance between consecutive rows, in entries.
+    std::ptrdiff_t m_rowstride;
+
+    /// The distance between consecutive columns, in entries.
+    std::ptrdiff_t m_colstride;
+};
+
+} // namespace sciplot
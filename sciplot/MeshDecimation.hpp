@@ -0,0 +1,338 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Isosurface.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The weight of the planes through the border edges of a mesh, perpendicular to their triangle, which keep open borders in place as the mesh is simplified.
+const auto MESH_BOUNDARY_WEIGHT = 100.0;
+
+/// The quadric error of a vertex, the sum of its squared distances to a set of planes, stored as the upper triangle of a symmetric 4 x 4 matrix.
+struct Quadric
+{
+    std::array<double, 10> q = {}; ///< The entries (0, 0), (0, 1), (0, 2), (0, 3), (1, 1), (1, 2), (1, 3), (2, 2), (2, 3), and (3, 3) of the matrix
+
+    /// Add the plane with unit normal (@p a, @p b, @p c) and offset @p d (the points p with a px + b py + c pz + d = 0) with given @p weight.
+    auto addplane(double a, double b, double c, double d, double weight) -> void
+    {
+        const double terms[10] = {a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d};
+        for (int k = 0; k < 10; ++k)
+            q[k] += weight * terms[k];
+    }
+
+    /// Add the planes of the given @p other quadric.
+    auto operator+=(const Quadric& other) -> Quadric&
+    {
+        for (int k = 0; k < 10; ++k)
+            q[k] += other.q[k];
+        return *this;
+    }
+
+    /// Return the quadric error at the point (@p x, @p y, @p z).
+    auto error(double x, double y, double z) const -> double
+    {
+        return q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x + q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y + q[7] * z * z + 2.0 * q[8] * z + q[9];
+    }
+
+    /// Set @p p to the point of least quadric error and return true, or return false if there is no single such point (e.g., when all planes are parallel).
+    auto optimum(std::array<double, 3>& p) const -> bool
+    {
+        const auto det = q[0] * (q[4] * q[7] - q[5] * q[5]) - q[1] * (q[1] * q[7] - q[5] * q[2]) + q[2] * (q[1] * q[5] - q[4] * q[2]);
+        const auto scale = q[0] + q[4] + q[7];
+        if (!(std::abs(det) > 1e-9 * scale * scale * scale))
+            return false;
+        // Cramer's rule for the gradient of the error being zero
+        const auto bx = -q[3], by = -q[6], bz = -q[8];
+        p[0] = (bx * (q[4] * q[7] - q[5] * q[5]) - q[1] * (by * q[7] - q[5] * bz) + q[2] * (by * q[5] - q[4] * bz)) / det;
+        p[1] = (q[0] * (by * q[7] - q[5] * bz) - bx * (q[1] * q[7] - q[5] * q[2]) + q[2] * (q[1] * bz - by * q[2])) / det;
+        p[2] = (q[0] * (q[4] * bz - by * q[5]) - q[1] * (q[1] * bz - by * q[2]) + bx * (q[1] * q[5] - q[4] * q[2])) / det;
+        return true;
+    }
+};
+
+/// Return the mesh obtained by collapsing edges of @p mesh in order of increasing quadric error (Garland and Heckbert), each into the point of least error of its two vertices.
+/// Collapses continue while the mesh has more than @p maxfaces triangles or the next collapse has a quadric error (a sum of squared distances) of at most @p tolerance squared
+/// (a negative @p tolerance disables the latter). Collapses that would flip a triangle or join two sheets of the surface are skipped, and open borders are kept in place
+/// by planes perpendicular to them (see @ref MESH_BOUNDARY_WEIGHT). Only the vertices still used by a triangle are kept.
+inline auto decimatemesh(const TriangleMesh& mesh, std::size_t maxfaces, double tolerance) -> TriangleMesh
+{
+    const auto numvertices = mesh.x.size();
+    auto numfaces = mesh.numtriangles();
+    std::vector<std::array<double, 3>> points(numvertices);
+    for (std::size_t v = 0; v < numvertices; ++v)
+        points[v] = {mesh.x[v], mesh.y[v], mesh.z[v]};
+    std::vector<std::array<std::size_t, 3>> faces(numfaces);
+    for (std::size_t t = 0; t < numfaces; ++t)
+        faces[t] = {mesh.triangles[3 * t], mesh.triangles[3 * t + 1], mesh.triangles[3 * t + 2]};
+
+    const auto normalof = [&](const std::array<double, 3>& a, const std::array<double, 3>& b, const std::array<double, 3>& c) -> std::array<double, 3> {
+        const double u[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        const double w[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+        return {u[1] * w[2] - u[2] * w[1], u[2] * w[0] - u[0] * w[2], u[0] * w[1] - u[1] * w[0]};
+    };
+
+    // The quadric of every vertex sums the planes of its triangles, and of the planes along the border edges it lies on
+    std::vector<Quadric> quadrics(numvertices);
+    std::vector<std::vector<std::size_t>> facesat(numvertices);
+    std::vector<std::pair<std::pair<std::size_t, std::size_t>, std::size_t>> edges;
+    edges.reserve(3 * numfaces);
+    for (std::size_t t = 0; t < numfaces; ++t)
+    {
+        const auto& f = faces[t];
+        const auto n = normalof(points[f[0]], points[f[1]], points[f[2]]);
+        const auto length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        for (int m = 0; m < 3; ++m)
+        {
+            facesat[f[m]].push_back(t);
+            edges.push_back({{std::min(f[m], f[(m + 1) % 3]), std::max(f[m], f[(m + 1) % 3])}, t});
+        }
+        if (length == 0.0)
+            continue;
+        const auto d = -(n[0] * points[f[0]][0] + n[1] * points[f[0]][1] + n[2] * points[f[0]][2]) / length;
+        for (int m = 0; m < 3; ++m)
+            quadrics[f[m]].addplane(n[0] / length, n[1] / length, n[2] / length, d, 1.0);
+    }
+    std::sort(edges.begin(), edges.end());
+    for (std::size_t k = 0; k < edges.size(); ++k)
+    {
+        const auto shared = (k > 0 && edges[k - 1].first == edges[k].first) || (k + 1 < edges.size() && edges[k + 1].first == edges[k].first);
+        if (shared)
+            continue;
+        const auto [a, b] = edges[k].first;
+        const auto& f = faces[edges[k].second];
+        const auto n = normalof(points[f[0]], points[f[1]], points[f[2]]);
+        const double e[3] = {points[b][0] - points[a][0], points[b][1] - points[a][1], points[b][2] - points[a][2]};
+        double p[3] = {e[1] * n[2] - e[2] * n[1], e[2] * n[0] - e[0] * n[2], e[0] * n[1] - e[1] * n[0]};
+        const auto length = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+        if (length == 0.0)
+            continue;
+        for (auto& component : p)
+            component /= length;
+        const auto d = -(p[0] * points[a][0] + p[1] * points[a][1] + p[2] * points[a][2]);
+        quadrics[a].addplane(p[0], p[1], p[2], d, MESH_BOUNDARY_WEIGHT);
+        quadrics[b].addplane(p[0], p[1], p[2], d, MESH_BOUNDARY_WEIGHT);
+    }
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const auto& l, const auto& r) { return l.first == r.first; }), edges.end());
+
+    // The candidate collapses, ordered by their error, are discarded when popped if a vertex of theirs changed since they were computed
+    struct Candidate
+    {
+        double cost;
+        std::size_t u, v, stampu, stampv;
+        std::array<double, 3> point;
+        auto operator>(const Candidate& other) const -> bool { return cost > other.cost; }
+    };
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+    std::vector<std::size_t> stamps(numvertices, 0);
+    std::vector<char> alivevertex(numvertices, 1);
+    std::vector<char> aliveface(numfaces, 1);
+    const auto push = [&](std::size_t u, std::size_t v) {
+        auto quadric = quadrics[u];
+        quadric += quadrics[v];
+        Candidate candidate = {0.0, u, v, stamps[u], stamps[v], {}};
+        if (!quadric.optimum(candidate.point))
+        {
+            // Without a single optimum, use the best of the two vertices and their midpoint
+            const std::array<double, 3> mid = {0.5 * (points[u][0] + points[v][0]), 0.5 * (points[u][1] + points[v][1]), 0.5 * (points[u][2] + points[v][2])};
+            candidate.point = mid;
+            for (const auto& p : {points[u], points[v]})
+                if (quadric.error(p[0], p[1], p[2]) < quadric.error(candidate.point[0], candidate.point[1], candidate.point[2]))
+                    candidate.point = p;
+        }
+        candidate.cost = std::max(quadric.error(candidate.point[0], candidate.point[1], candidate.point[2]), 0.0);
+        candidates.push(candidate);
+    };
+    for (const auto& edge : edges)
+        push(edge.first.first, edge.first.second);
+
+    const auto neighbours = [&](std::size_t u) {
+        std::vector<std::size_t> result;
+        for (const auto t : facesat[u])
+            if (aliveface[t])
+                for (const auto w : faces[t])
+                    if (w != u)
+                        result.push_back(w);
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    };
+
+    const auto threshold = tolerance < 0.0 ? -1.0 : tolerance * tolerance;
+    while (!candidates.empty())
+    {
+        const auto candidate = candidates.top();
+        if (numfaces <= maxfaces && !(candidate.cost <= threshold))
+            break;
+        candidates.pop();
+        const auto u = candidate.u;
+        const auto v = candidate.v;
+        if (!alivevertex[u] || !alivevertex[v] || stamps[u] != candidate.stampu || stamps[v] != candidate.stampv)
+            continue;
+
+        // The vertices may only share the neighbours across the triangles of their edge, or the surface would be pinched
+        const auto nu = neighbours(u);
+        const auto nv = neighbours(v);
+        std::vector<std::size_t> common;
+        std::set_intersection(nu.begin(), nu.end(), nv.begin(), nv.end(), std::back_inserter(common));
+        std::size_t numshared = 0;
+        for (const auto t : facesat[u])
+            numshared += aliveface[t] && (faces[t][0] == v || faces[t][1] == v || faces[t][2] == v);
+        if (numshared == 0 || common.size() != numshared)
+            continue;
+
+        // Skip collapses turning any remaining triangle around
+        auto flips = false;
+        for (const auto w : {u, v})
+        {
+            for (const auto t : facesat[w])
+            {
+                const auto& f = faces[t];
+                if (!aliveface[t] || ((f[0] == u || f[1] == u || f[2] == u) && (f[0] == v || f[1] == v || f[2] == v)))
+                    continue;
+                std::array<std::array<double, 3>, 3> moved = {points[f[0]], points[f[1]], points[f[2]]};
+                for (int m = 0; m < 3; ++m)
+                    if (f[m] == w)
+                        moved[m] = candidate.point;
+                const auto before = normalof(points[f[0]], points[f[1]], points[f[2]]);
+                const auto after = normalof(moved[0], moved[1], moved[2]);
+                flips = flips || before[0] * after[0] + before[1] * after[1] + before[2] * after[2] < 0.0;
+            }
+        }
+        if (flips)
+            continue;
+
+        // Move u to the optimum, remove the triangles of the edge, and hand the other triangles of v over to u
+        for (const auto t : facesat[v])
+        {
+            if (!aliveface[t])
+                continue;
+            auto& f = faces[t];
+            if (f[0] == u || f[1] == u || f[2] == u)
+            {
+                aliveface[t] = 0;
+                --numfaces;
+                continue;
+            }
+            for (auto& w : f)
+                if (w == v)
+                    w = u;
+            facesat[u].push_back(t);
+        }
+        facesat[v].clear();
+        facesat[u].erase(std::remove_if(facesat[u].begin(), facesat[u].end(), [&](std::size_t t) { return !aliveface[t]; }), facesat[u].end());
+        alivevertex[v] = 0;
+        points[u] = candidate.point;
+        quadrics[u] += quadrics[v];
+        ++stamps[u];
+        for (const auto w : neighbours(u))
+            push(u, w);
+    }
+
+    // Keep the remaining triangles and the vertices they use, in their original order
+    TriangleMesh result;
+    const auto none = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> index(numvertices, none);
+    for (std::size_t t = 0; t < faces.size(); ++t)
+    {
+        if (!aliveface[t])
+            continue;
+        for (const auto w : faces[t])
+        {
+            if (index[w] == none)
+            {
+                index[w] = result.x.size();
+                result.x.push_back(points[w][0]);
+                result.y.push_back(points[w][1]);
+                result.z.push_back(points[w][2]);
+            }
+            result.triangles.push_back(index[w]);
+        }
+    }
+    return result;
+}
+
+} // namespace internal
+
+/// The specification of how a triangle mesh is simplified before it is drawn, by collapsing its edges in order of increasing quadric error.
+class MeshDecimation
+{
+  public:
+    /// Return the specification keeping every triangle of the mesh.
+    static auto none() -> MeshDecimation { return MeshDecimation(0, -1.0); }
+
+    /// Return the specification simplifying the mesh down to at most @p count triangles.
+    static auto faces(std::size_t count) -> MeshDecimation
+    {
+        if (count == 0)
+            throw std::invalid_argument("A decimated mesh must keep at least one triangle.");
+        return MeshDecimation(count, -1.0);
+    }
+
+    /// Return the specification simplifying the mesh as long as it moves by at most @p error pixels on screen (at the resolution of the plot, see Plot::resolution), relative to the largest side of its bounding box.
+    static auto pixels(double error) -> MeshDecimation
+    {
+        if (!(error > 0.0))
+            throw std::invalid_argument("The screen-space error of a mesh decimation must be positive.");
+        return MeshDecimation(0, error);
+    }
+
+    /// Return the maximum number of triangles of the simplified mesh (zero if there is no such limit).
+    auto maxfaces() const -> std::size_t { return m_maxfaces; }
+
+    /// Return the maximum screen-space error of the simplification in pixels (negative if there is no such limit).
+    auto maxpixels() const -> double { return m_maxpixels; }
+
+  private:
+    /// Construct a MeshDecimation object with given maximum number of triangles and screen-space error.
+    MeshDecimation(std::size_t maxfaces, double maxpixels)
+        : m_maxfaces(maxfaces), m_maxpixels(maxpixels) {}
+
+    /// The maximum number of triangles of the simplified mesh (zero if there is no such limit).
+    std::size_t m_maxfaces;
+
+    /// The maximum screen-space error of the simplification in pixels (negative if there is no such limit).
+    double m_maxpixels;
+};
+
+} // namespace sciplot
@@ -0,0 +1,130 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The minimum number of items processed by each thread of a parallel loop over cheap items (e.g., samples being binned).
+const auto PARALLEL_GRAIN_SIZE = 1 << 16;
+
+/// Return the number of threads to use for a loop over @p size items, giving each thread at least @p grain items.
+inline auto numthreads(std::size_t size, std::size_t grain = PARALLEL_GRAIN_SIZE) -> std::size_t
+{
+    const auto hardware = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    return std::max<std::size_t>(1, std::min(hardware, size / std::max<std::size_t>(grain, 1)));
+}
+
+/// Call `f(begin, end, ithread)` for @p nthreads contiguous chunks of the range [0, @p size), each chunk on its own thread.
+/// The calling thread processes the first chunk. Exceptions thrown by @p f are rethrown in the calling thread.
+template <typename Function>
+auto parallelfor(std::size_t size, std::size_t nthreads, const Function& f) -> void
+{
+    nthreads = std::max<std::size_t>(std::min(nthreads, size), 1);
+    if (nthreads == 1)
+    {
+        f(std::size_t(0), size, std::size_t(0));
+        return;
+    }
+    std::exception_ptr error;
+    std::mutex errormutex;
+    const auto run = [&](std::size_t ithread) {
+        try
+        {
+            f(ithread * size / nthreads, (ithread + 1) * size / nthreads, ithread);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errormutex);
+            if (!error)
+                error = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads - 1);
+    for (std::size_t ithread = 1; ithread < nthreads; ++ithread)
+        threads.emplace_back(run, ithread);
+    run(0);
+    for (auto& thread : threads)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+/// Call `f(begin, end, ithread)` for contiguous chunks of the range [0, @p size) on as many threads as worthwhile for cheap items (see @ref numthreads).
+template <typename Function>
+auto parallelfor(std::size_t size, const Function& f) -> void
+{
+    parallelfor(size, numthreads(size), f);
+}
+
+/// Sort the given @p values in ascending order, sorting @p nthreads contiguous chunks on separate threads and then merging them pairwise (the merges of every round also run in parallel).
+template <typename T>
+auto parallelsort(std::vector<T>& values, std::size_t nthreads) -> void
+{
+    const auto size = values.size();
+    nthreads = std::max<std::size_t>(std::min(nthreads, size), 1);
+    if (nthreads == 1)
+    {
+        std::sort(values.begin(), values.end());
+        return;
+    }
+    std::vector<std::size_t> bounds(nthreads + 1);
+    for (std::size_t i = 0; i <= nthreads; ++i)
+        bounds[i] = i * size / nthreads;
+    const auto at = [&](std::size_t chunk) { return values.begin() + bounds[std::min(chunk, nthreads)]; };
+    parallelfor(nthreads, nthreads, [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (auto chunk = begin; chunk < end; ++chunk)
+            std::sort(at(chunk), at(chunk + 1));
+    });
+    for (std::size_t width = 1; width < nthreads; width *= 2)
+    {
+        const auto nmerges = (nthreads + 2 * width - 1) / (2 * width);
+        parallelfor(nmerges, nmerges, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (auto m = begin; m < end; ++m)
+                std::inplace_merge(at(2 * width * m), at(2 * width * m + width), at(2 * width * (m + 1)));
+        });
+    }
+}
+
+/// Sort the given @p values in ascending order using as many threads as worth it for their number.
+template <typename T>
+auto parallelsort(std::vector<T>& values) -> void
+{
+    parallelsort(values, numthreads(values.size()));
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -26,6 +26,7 @@
 #pragma once
 
 // C++ includes
+#include <chrono>
 #include <sstream>
 #include <vector>
 
@@ -34,6 +35,7 @@
 #include <sciplot/Default.hpp>
 #include <sciplot/Enums.hpp>
 #include <sciplot/Palettes.hpp>
+#include <sciplot/RenderStats.hpp>
 #include <sciplot/StringOrDouble.hpp>
 #include <sciplot/Utils.hpp>
 #include <sciplot/specs/AxisLabelSpecs.hpp>
@@ -69,6 +71,11 @@ class Plot
     /// Set the size of the plot (in unit of points, with 1 inch = 72 points).
     auto size(std::size_t width, std::size_t height) -> Plot&;
 
+    /// Set the resolution (in pixels) of the output to which data drawn from vectors is reduced before it is written.
+    /// Call it before drawing, e.g. with the size given to @ref Canvas::size, since the canvas that renders the plot is unknown at draw time.
+    /// Without it, data is reduced to the size of the plot (see @ref size), or to the default canvas size if none is given.
+    auto resolution(std::size_t width, std::size_t height) -> Plot&;
+
     /// Set the font name for the plot (e.g., Helvetica, Georgia, Times).
     auto fontName(const std::string& name) -> Plot&;
 
@@ -183,6 +190,19 @@ class Plot
     /// Set the number of sample points for analytical plots.
     auto samples(std::size_t value) -> void;
 
+    /// Set the maximum number of rows written for each curve drawn from vectors (zero to disable).
+    /// Curves with more rows are reduced to the extrema visible at the plot resolution (see @ref resolution), more aggressively if needed.
+    /// Budgets below four rows are raised to four, so that a curve keeps at least its first, lowest, highest and last rows.
+    auto pointBudget(std::size_t rows) -> Plot&;
+
+    /// Set the time budget (in milliseconds) for formatting and rendering the curves drawn from vectors (zero to disable).
+    /// Each draw is allowed the number of rows that fits into the remaining budget according to the measured formatting and gnuplot throughputs.
+    /// Once the budget is spent, every further draw is still allowed four rows as with @ref pointBudget.
+    auto latencyBudget(double milliseconds) -> Plot&;
+
+    /// Return the statistics recorded for the draw calls of the plot, including the decisions taken to meet its point or latency budget.
+    auto renderStats() const -> const RenderStats& { return m_renderstats; }
+
     /// Use this method to provide gnuplot commands to be executed before the plotting calls.
     auto gnuplot(const std::string& command) -> void;
 
@@ -204,15 +224,36 @@ class Plot
     virtual auto repr() const -> std::string = 0;
 
   protected:
+    /// Return the number of pixel columns of the plot, used when reducing data to the plot resolution before writing it.
+    auto pixelsX() const -> std::size_t { return m_resolutionx ? m_resolutionx : m_width ? m_width : internal::DEFAULT_FIGURE_WIDTH; }
+
+    /// Return the number of pixel rows of the plot, used when reducing data to the plot resolution before writing it.
+    auto pixelsY() const -> std::size_t { return m_resolutiony ? m_resolutiony : m_height ? m_height : internal::DEFAULT_FIGURE_HEIGHT; }
+
+    /// Return the maximum number of rows the next draw may write according to the point and latency budgets (zero if there is no budget).
+    auto rowAllowance() const -> std::size_t;
+
+    /// Record the statistics @p stats of a draw whose rows were written since @p start, refining the estimated formatting throughput with them unless they were written as @p binary data.
+    auto recordDraw(DrawStats stats, std::chrono::steady_clock::time_point start, bool binary = false) -> void;
+
+    /// Save the given @p bytes as a new binary data set in its own file and draw it, where @p binary describes its layout to gnuplot (e.g., "binary matrix").
+    auto drawWithBinaryData(std::string bytes, const std::string& binary, const std::string& use, const std::string& with) -> DrawSpecs&;
+
+    /// Return the name of the file where the binary data set with given @p index is saved.
+    auto binaryDataFilename(std::size_t index) const -> std::string { return "plot" + internal::str(m_id) + "-" + internal::str(index) + ".bin"; }
+
     static std::size_t m_counter; ///< Counter of how many plot / singleplot objects have been instanciated in the application
     std::size_t m_id = 0; ///< The Plot id derived from m_counter upon construction (must be the first member due to constructor initialization order!)
     bool m_autoclean = true; ///< Toggle automatic cleaning of temporary files (enabled by default)
     std::string m_palette; ///< The name of the gnuplot palette to be used
     std::size_t m_width = 0; ///< The size of the plot in x
     std::size_t m_height = 0; ///< The size of the plot in y
+    std::size_t m_resolutionx = 0; ///< The number of pixel columns of the output to which data is reduced (zero to use the plot size)
+    std::size_t m_resolutiony = 0; ///< The number of pixel rows of the output to which data is reduced (zero to use the plot size)
     std::string m_datafilename; ///< The multi data set file where data given to plot (e.g., vectors) are saved
     std::string m_data; ///< The current plot data as a string
     std::size_t m_numdatasets = 0; ///< The current number of data sets in the data file
+    std::vector<std::string> m_binarydata; ///< The binary data sets (e.g., matrices drawn as images), each saved to its own file
     FontSpecs m_font; ///< The font name and size in the plot
     BorderSpecs m_border; ///< The border style of the plot
     GridSpecs m_grid; ///< The vector of grid specs for the major and minor grid lines in the plot (for xtics, ytics, mxtics, etc.).
@@ -241,6 +282,9 @@ class Plot
     LegendSpecs m_legend; ///< The legend specs of the plot
     std::vector<DrawSpecs> m_drawspecs; ///< The plot specs for each call to gnuplot plot function
     std::vector<std::string> m_customcmds; ///< The strings containing gnuplot custom commands
+    std::size_t m_pointbudget = 0; ///< The maximum number of rows written for each curve (zero if disabled)
+    double m_latencybudget = 0.0; ///< The time budget in milliseconds for formatting and rendering the plot data (zero if disabled)
+    RenderStats m_renderstats; ///< The statistics recorded for the draw calls of the plot
 };
 
 // Initialize the counter of plot objects
@@ -285,6 +329,13 @@ inline auto Plot::size(std::size_t width, std::size_t height) -> Plot&
     return *this;
 }
 
+inline auto Plot::resolution(std::size_t width, std::size_t height) -> Plot&
+{
+    m_resolutionx = width;
+    m_resolutiony = height;
+    return *this;
+}
+
 inline auto Plot::fontName(const std::string& name) -> Plot&
 {
     m_font.fontName(name);
@@ -347,6 +398,24 @@ inline auto Plot::draw(const std::string& what, const std::string& use, const st
     return m_drawspecs.back();
 }
 
+inline auto Plot::recordDraw(DrawStats stats, std::chrono::steady_clock::time_point start, bool binary) -> void
+{
+    stats.formatseconds = internal::secondssince(start);
+    stats.estimatedseconds = internal::estimatedseconds(stats.rowsout);
+    // Binary data is written much faster than text, so it would overestimate the rate at which text rows are formatted
+    if (!binary)
+        internal::calibrate(internal::throughput().format, stats.rowsout, stats.formatseconds);
+    m_renderstats.draws.push_back(std::move(stats));
+}
+
+inline auto Plot::drawWithBinaryData(std::string bytes, const std::string& binary, const std::string& use, const std::string& with) -> DrawSpecs&
+{
+    // Binary data cannot share the text data file, so every binary data set gets a file of its own
+    const auto filename = binaryDataFilename(m_binarydata.size());
+    m_binarydata.push_back(std::move(bytes));
+    return draw("'" + filename + "' " + binary, use, with);
+}
+
 //======================================================================
 // MISCELLANEOUS METHODS
 //======================================================================
@@ -361,6 +430,35 @@ inline auto Plot::samples(std::size_t value) -> void
     m_samples = internal::str(value);
 }
 
+inline auto Plot::pointBudget(std::size_t rows) -> Plot&
+{
+    m_pointbudget = rows;
+    return *this;
+}
+
+inline auto Plot::latencyBudget(double milliseconds) -> Plot&
+{
+    m_latencybudget = milliseconds;
+    return *this;
+}
+
+inline auto Plot::rowAllowance() const -> std::size_t
+{
+    if (m_pointbudget == 0 && m_latencybudget <= 0.0)
+        return 0;
+    auto allowance = m_pointbudget;
+    if (m_latencybudget > 0.0)
+    {
+        auto spent = 0.0;
+        for (const auto& draw : m_renderstats.draws)
+            spent += draw.estimatedseconds;
+        const auto rows = internal::affordablerows(m_latencybudget / 1000.0 - spent);
+        allowance = allowance ? std::min(allowance, rows) : rows;
+    }
+    // Never go below the first, lowest, highest and last rows of a curve, which also keeps an exhausted latency budget from reading as no budget
+    return std::max<std::size_t>(allowance, 4);
+}
+
 inline auto Plot::gnuplot(const std::string& command) -> void
 {
     m_customcmds.push_back(command);
@@ -374,6 +472,11 @@ inline auto Plot::savePlotData() const -> void
         std::ofstream data(m_datafilename);
         data << m_data;
     }
+    for (std::size_t i = 0; i < m_binarydata.size(); ++i)
+    {
+        std::ofstream data(binaryDataFilename(i), std::ios::binary);
+        data.write(m_binarydata[i].data(), static_cast<std::streamsize>(m_binarydata[i].size()));
+    }
 }
 
 inline auto Plot::autoclean(bool enable) -> void
@@ -384,12 +487,15 @@ inline auto Plot::autoclean(bool enable) -> void
 inline auto Plot::cleanup() const -> void
 {
     std::remove(m_datafilename.c_str());
+    for (std::size_t i = 0; i < m_binarydata.size(); ++i)
+        std::remove(binaryDataFilename(i).c_str());
 }
 
 inline auto Plot::clear() -> void
 {
     m_drawspecs.clear();
     m_customcmds.clear();
+    m_renderstats = {};
 }
 
 } // namespace sciplot
@@ -26,15 +26,35 @@
 #pragma once
 
 // C++ includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <limits>
 #include <sstream>
+#include <stdexcept>
+#include <tuple>
 #include <vector>
 
 // sciplot includes
 #include <sciplot/Constants.hpp>
+#include <sciplot/Contour.hpp>
+#include <sciplot/Correlation.hpp>
+#include <sciplot/Decimation.hpp>
 #include <sciplot/Default.hpp>
+#include <sciplot/Density.hpp>
 #include <sciplot/Enums.hpp>
+#include <sciplot/Fit.hpp>
+#include <sciplot/Hexbin.hpp>
+#include <sciplot/Histogram.hpp>
+#include <sciplot/LevelOfDetail.hpp>
+#include <sciplot/MatrixView.hpp>
 #include <sciplot/Palettes.hpp>
 #include <sciplot/Plot.hpp>
+#include <sciplot/Quantiles.hpp>
+#include <sciplot/Sampling.hpp>
+#include <sciplot/Smoothing.hpp>
+#include <sciplot/Spectrum.hpp>
 #include <sciplot/StringOrDouble.hpp>
 #include <sciplot/Utils.hpp>
 #include <sciplot/specs/AxisLabelSpecs.hpp>
@@ -64,6 +84,8 @@ class Plot2D : public Plot
     // METHODS FOR DRAWING PLOT ELEMENTS
     //======================================================================
     /// Draw plot object with given style and given vectors (e.g., `plot.draw("lines", x, y)`).
+    /// Curves drawn with `lines`, `impulses` or `filledcurves` are reduced if they exceed the point or latency budget of the plot.
+    /// Curves drawn with `steps`, `fsteps`, `histeps` or `fillsteps` have runs of repeated *y* values removed, and their sub-pixel transitions collapsed if they still exceed the budget.
     template <typename X, typename... Vecs>
     auto drawWithVecs(const std::string& with, const X&, const Vecs&... vecs) -> DrawSpecs&;
 
@@ -75,6 +97,16 @@ class Plot2D : public Plot
     template <typename X, typename Y>
     auto drawCurve(const X& x, const Y& y) -> DrawSpecs&;
 
+    /// Draw a curve with given @p x and @p y vectors after smoothing @p y natively (e.g., `Smoothing::median(25)`), so that only the smoothed values are written.
+    template <typename X, typename Y>
+    auto drawCurve(const X& x, const Y& y, const Smoothing& smoothing) -> DrawSpecs&;
+
+    /// Draw a curve stored in a level of detail pyramid @p lod, reduced to the width of the plot.
+    auto drawCurve(const LevelOfDetail& lod) -> DrawSpecs&;
+
+    /// Draw the part of a curve stored in a level of detail pyramid @p lod within [@p x0, @p x1], reduced to the width of the plot.
+    auto drawCurve(const LevelOfDetail& lod, double x0, double x1) -> DrawSpecs&;
+
     /// Draw a curve with points with given @p x and @p y vectors.
     template <typename X, typename Y>
     auto drawCurveWithPoints(const X& x, const Y& y) -> DrawSpecs&;
@@ -159,6 +191,30 @@ class Plot2D : public Plot
     template <typename X, typename Y, typename XL, typename XH, typename YL, typename YH>
     auto drawErrorBarsXY(const X& x, const Y& y, const XL& xlow, const XH& xhigh, const YL& ylow, const YH& yhigh) -> DrawSpecs&;
 
+    /// Draw error bars along *y* with given @p x, @p y, and @p ydelta vectors, aggregated into one bar per pixel column spanning the lowest to the highest bound in it.
+    template <typename X, typename Y, typename YD>
+    auto drawErrorBarsYEnvelope(const X& x, const Y& y, const YD& ydelta) -> DrawSpecs&;
+
+    /// Draw error bars along *y* with given @p x, @p y, @p ylow, and @p yhigh vectors, aggregated into one bar per pixel column spanning the lowest to the highest bound in it.
+    template <typename X, typename Y, typename YL, typename YH>
+    auto drawErrorBarsYEnvelope(const X& x, const Y& y, const YL& ylow, const YH& yhigh) -> DrawSpecs&;
+
+    /// Draw a curve with error bars along *y* with given @p x, @p y, and @p ydelta vectors, aggregated into one bar per pixel column.
+    template <typename X, typename Y, typename YD>
+    auto drawCurveWithErrorBarsYEnvelope(const X& x, const Y& y, const YD& ydelta) -> DrawSpecs&;
+
+    /// Draw a curve with error bars along *y* with given @p x, @p y, @p ylow, and @p yhigh vectors, aggregated into one bar per pixel column.
+    template <typename X, typename Y, typename YL, typename YH>
+    auto drawCurveWithErrorBarsYEnvelope(const X& x, const Y& y, const YL& ylow, const YH& yhigh) -> DrawSpecs&;
+
+    /// Draw a filled band along *y* with given @p x, @p y, and @p ydelta vectors, aggregated per pixel column as in @ref drawErrorBarsYEnvelope.
+    template <typename X, typename Y, typename YD>
+    auto drawErrorBandYEnvelope(const X& x, const Y& y, const YD& ydelta) -> DrawSpecs&;
+
+    /// Draw a filled band along *y* with given @p x, @p y, @p ylow, and @p yhigh vectors, aggregated per pixel column as in @ref drawErrorBarsYEnvelope.
+    template <typename X, typename Y, typename YL, typename YH>
+    auto drawErrorBandYEnvelope(const X& x, const Y& y, const YL& ylow, const YH& yhigh) -> DrawSpecs&;
+
     /// Draw steps with given @p x and @p y vectors. Identical to @ref drawStepsChangeFirstX.
     template <typename X, typename Y>
     auto drawSteps(const X& x, const Y& y) -> DrawSpecs&;
@@ -195,6 +251,161 @@ class Plot2D : public Plot
     template <typename Y>
     auto drawHistogram(const Y& y) -> DrawSpecs&;
 
+    /// Draw a histogram of the given @p samples, binned natively according to @p bins and drawn as boxes (only the bins are written, not the samples).
+    template <typename S>
+    auto drawBinnedHistogram(const S& samples, const Bins& bins = Bins::automatic()) -> DrawSpecs&;
+
+    /// Draw a histogram of the given @p samples with given @p weights, binned natively according to @p bins and drawn as boxes.
+    template <typename S, typename W>
+    auto drawBinnedHistogram(const S& samples, const W& weights, const Bins& bins) -> DrawSpecs&;
+
+    /// Draw boxes for bins with given @p edges and @p counts (there must be one more edge than counts).
+    auto drawHistogramBins(const std::vector<double>& edges, const std::vector<double>& counts) -> DrawSpecs&;
+
+    /// Draw the bins of an accumulated @p histogram as boxes.
+    auto drawHistogram(const Histogram& histogram) -> DrawSpecs&;
+
+    /// Draw the outline of the bins of an accumulated @p histogram as steps.
+    auto drawStepsHistogram(const Histogram& histogram) -> DrawSpecs&;
+
+    /// Draw a two-dimensional histogram of the pairs (@p x, @p y), binned natively according to @p binsx and @p binsy and colored with the plot palette (only the bins are written, not the samples).
+    template <typename X, typename Y>
+    auto drawHistogram2D(const X& x, const Y& y, const Bins& binsx = Bins::automatic(), const Bins& binsy = Bins::automatic()) -> DrawSpecs&;
+
+    /// Draw a two-dimensional histogram of the pairs (@p x, @p y) with given @p weights, binned natively according to @p binsx and @p binsy and colored with the plot palette.
+    template <typename X, typename Y, typename W>
+    auto drawHistogram2D(const X& x, const Y& y, const W& weights, const Bins& binsx, const Bins& binsy) -> DrawSpecs&;
+
+    /// Draw the bins of a grid with given @p edgesx and @p edgesy colored by their @p counts, given row by row (one row per y bin).
+    /// Equally spaced bins are written as a binary matrix drawn as an image, averaged over neighboring bins if there are more of them than the point or latency budget of the plot allows,
+    /// and other bins as boxes filled with the color of their counts.
+    auto drawHistogram2DBins(const std::vector<double>& edgesx, const std::vector<double>& edgesy, const std::vector<double>& counts) -> DrawSpecs&;
+
+    /// Draw the number of points (@p x, @p y) falling into each of a grid of hexagons, @p gridsize across the x range, colored with the plot palette (only the non-empty hexagons are written).
+    /// The grid is made coarser if the vertices of the non-empty hexagons exceed the point or latency budget of the plot.
+    template <typename X, typename Y>
+    auto drawHexbin(const X& x, const Y& y, std::size_t gridsize = internal::DEFAULT_HEXBIN_GRIDSIZE) -> DrawSpecs&;
+
+    /// Draw the sum of the @p weights of the points (@p x, @p y) falling into each of a grid of hexagons, @p gridsize across the x range, colored with the plot palette.
+    template <typename X, typename Y, typename W>
+    auto drawHexbin(const X& x, const Y& y, const W& weights, std::size_t gridsize) -> DrawSpecs&;
+
+    /// Draw the Gaussian kernel density estimate of the given @p samples with given @p bandwidth as a curve (only the evaluated points are written, not the samples).
+    template <typename S>
+    auto drawDensity(const S& samples, const Bandwidth& bandwidth = Bandwidth::scott()) -> DrawSpecs&;
+
+    /// Draw the Gaussian kernel density estimate of the given @p samples with given @p bandwidth as a filled curve.
+    template <typename S>
+    auto drawDensityFilled(const S& samples, const Bandwidth& bandwidth = Bandwidth::scott()) -> DrawSpecs&;
+
+    /// Draw the Pearson correlation matrix of the given @p columns (e.g., a vector of series of equal length) as an image colored with the palette of the plot.
+    /// The matrix is computed natively (see @ref internal::correlationmatrix) and written as a binary matrix. Rows are drawn from top to bottom, so the ranges of the plot are set to fit the matrix,
+    /// and the given @p labels (if any) name the series along both axes.
+    template <typename Columns>
+    auto drawCorrelationMatrix(const Columns& columns, const std::vector<std::string>& labels = {}) -> DrawSpecs&;
+
+    /// Draw the matrix @p values as an image colored with the palette of the plot, spanning [@p x0, @p x1] along *x* and [@p y0, @p y1] along *y*, with row 0 at the bottom.
+    /// The entries are written as a binary array of 32-bit floats, all of them by default. With @p pooling set to Pooling::mean or Pooling::max, matrices with more entries than
+    /// the plot has pixels (see @ref resolution) are first reduced to that resolution, or further to fit its point or latency budget, replacing every block of entries sharing a pixel with their mean or their maximum.
+    auto drawImage(const MatrixView& values, double x0, double x1, double y0, double y1, Pooling pooling = Pooling::none) -> DrawSpecs&;
+
+    /// Draw the matrices @p red, @p green, and @p blue (of equal size, with intensities from 0 to 255) as an RGB image spanning [@p x0, @p x1] along *x* and [@p y0, @p y1] along *y*, with row 0 at the bottom.
+    /// The channels are reduced according to @p pooling as in @ref drawImage. For pixels stored interleaved, pass views with a column stride of 3 starting at each channel.
+    auto drawRGBImage(const MatrixView& red, const MatrixView& green, const MatrixView& blue, double x0, double x1, double y0, double y1, Pooling pooling = Pooling::none) -> DrawSpecs&;
+
+    /// Draw the contours at the given @p levels of the field with values @p z (e.g., a vector of rows, with `z[j][i]` the value at `x[i]` and `y[j]`) over the grid of @p x by @p y coordinates.
+    /// The isolines are traced natively with marching squares and stitched into polylines, in parallel over tiles of the grid and over levels, and only the polylines are written,
+    /// as one data set with the level of every vertex as a third column, so that every level is drawn with its own color from the palette of the plot.
+    template <typename X, typename Y, typename Z>
+    auto drawContours(const X& x, const Y& y, const Z& z, const std::vector<double>& levels) -> DrawSpecs&;
+
+    /// Draw the contours at the given @p levels of the field with values @p z (with `z(j, i)` the value at `x[i]` and `y[j]`) over the grid of @p x by @p y coordinates, reading @p z through its strides without copying it.
+    template <typename X, typename Y>
+    auto drawContours(const X& x, const Y& y, const MatrixView& z, const std::vector<double>& levels) -> DrawSpecs&;
+
+    /// Draw the contours at the given @p levels of the field with values @p z over the uniform grid spanning [@p x0, @p x1] along its columns and [@p y0, @p y1] along its rows.
+    auto drawContours(const MatrixView& z, double x0, double x1, double y0, double y1, const std::vector<double>& levels) -> DrawSpecs&;
+
+    /// Draw the function @p f (any callable taking and returning a number) over [@p x0, @p x1], sampled adaptively for the resolution of the plot.
+    /// Segments are subdivided only where the curve bends by more than half a pixel, down to sub-pixel widths, and the curve is broken where @p f is discontinuous or returns NaN.
+    /// The points of every subdivision round are evaluated in parallel when @p f is expensive enough, so @p f must be safe to call concurrently.
+    /// The number of evaluations and the time they took are recorded in @ref renderStats.
+    template <typename Function>
+    auto drawFunction(const Function& f, double x0, double x1) -> DrawSpecs&;
+
+    /// Draw the function @p f over [@p x0, @p x1], sampled adaptively for the resolution of the plot, with the points of every subdivision round evaluated by the given @p executor.
+    template <typename Function>
+    auto drawFunction(const Function& f, double x0, double x1, const Executor& executor) -> DrawSpecs&;
+
+    /// Draw the one-sided power spectral density of the given @p signal sampled at frequency @p fs, computed natively by FFT (best seen with `plot.ytics().logscale()`).
+    /// If @p segment is zero, the density is the periodogram of the whole signal; otherwise it is averaged over segments of @p segment samples overlapping by half (Welch's method).
+    template <typename S>
+    auto drawPowerSpectrum(const S& signal, double fs, std::size_t segment = 0) -> DrawSpecs&;
+
+    /// Draw the spectrogram of the given @p signal sampled at frequency @p fs as an image of the power spectral density (in dB) over time and frequency.
+    /// Frames of @p window samples, starting every @p hop samples, are transformed in parallel, and the resulting matrix is averaged down to the pixel resolution of the plot (or further, to fit its point or latency budget) and written as a binary matrix.
+    template <typename S>
+    auto drawSpectrogram(const S& signal, double fs, std::size_t window, std::size_t hop) -> DrawSpecs&;
+
+    /// Draw the least-squares fit of @p model to the points with coordinates @p x and @p y, computed natively, as a curve sampled once per pixel across the range of @p x.
+    /// Only the fitted curve is written, not the points.
+    template <typename X, typename Y>
+    auto drawFit(const X& x, const Y& y, const FitModel& model = FitModel::linear()) -> DrawSpecs&;
+
+    /// Draw the given least-squares @p fit as a curve sampled once per pixel across the range of its *x* values (see @ref Fit::coefficients for its coefficients).
+    auto drawFit(const Fit& fit) -> DrawSpecs&;
+
+    /// Draw the confidence band at given @p level of the given least-squares @p fit as a filled area sampled once per pixel across the range of its *x* values.
+    auto drawFitConfidenceBand(const Fit& fit, double level = 0.95) -> DrawSpecs&;
+
+    /// Draw a violin plot of the given @p groups of samples (e.g., a vector of vectors), with the kernel density estimate of each group mirrored around x = 1, 2, 3, ...
+    /// The densities are computed natively on separate threads and share a common scale, so that violins of equal area hold equal fractions of the samples.
+    /// All outlines are written as blocks of a single data set and drawn by a single filled plot element, however many groups there are, with fewer points along them if they exceed the point or latency budget of the plot.
+    template <typename Groups>
+    auto drawViolin(const Groups& groups, const Bandwidth& bandwidth = Bandwidth::scott()) -> DrawSpecs&;
+
+    /// Draw a box plot of the given @p groups of samples (e.g., a vector of vectors), with boxes at x = 1, 2, 3, ... and at most @p maxoutliers outliers of each group drawn as points.
+    /// Only the summaries of the groups are written, not the samples, and the outliers are further subsampled if they exceed the point or latency budget of the plot.
+    template <typename Groups>
+    auto drawBoxPlot(const Groups& groups, std::size_t maxoutliers = internal::DEFAULT_BOXPLOT_MAX_OUTLIERS) -> DrawSpecs&;
+
+    /// Draw the given summaries as boxes with whiskers at x = 1, 2, 3, ..., their medians as lines and their outliers as points (the returned specs are those of the boxes).
+    auto drawBoxPlot(const std::vector<BoxSummary>& boxes) -> DrawSpecs&;
+
+    /// Draw a box plot of the samples accumulated by the given quantile @p sketches, with boxes at x = 1, 2, 3, ...
+    auto drawBoxPlot(const std::vector<QuantileSketch>& sketches) -> DrawSpecs&;
+
+    /// Draw the band between the quantiles @p plow and @p phigh of the samples accumulated by the given quantile @p sketches, one sketch for each entry of @p x.
+    template <typename X>
+    auto drawQuantileBand(const X& x, const std::vector<QuantileSketch>& sketches, double plow, double phigh) -> DrawSpecs&;
+
+    /// Draw the median of an ensemble of @p runs (e.g., a vector of runs, each with one value per entry of @p x) as a curve over filled bands between pairs of @p percentiles.
+    /// The lowest percentile is paired with the highest, the second lowest with the second highest, and so on. The returned specs are those of the median curve.
+    /// If there are more entries in @p x than the point or latency budget of the plot allows, the percentiles are computed at evenly spread entries only.
+    /// @throws std::invalid_argument if there are not as many distinct @p percentiles below 50 as above it, as some of them would bound no band.
+    template <typename X, typename Runs>
+    auto drawEnsemble(const X& x, const Runs& runs, std::vector<double> percentiles = {5.0, 25.0, 75.0, 95.0}) -> DrawSpecs&;
+
+    /// Draw the median and percentile bands of an ensemble of @p numruns runs stored contiguously in @p values, with the runs as rows of a matrix with given @p layout.
+    /// @throws std::invalid_argument if there are not as many distinct @p percentiles below 50 as above it.
+    template <typename X>
+    auto drawEnsemble(const X& x, const std::vector<double>& values, std::size_t numruns, MatrixLayout layout, std::vector<double> percentiles = {5.0, 25.0, 75.0, 95.0}) -> DrawSpecs&;
+
+    /// Draw all @p runs of an ensemble (e.g., a vector of runs, each with one value per entry of @p x) as curves written in a single data set and drawn by a single plot element.
+    /// Every run is reduced like a curve (see @ref pointBudget) to an equal share of the point or latency budget of the plot.
+    template <typename X, typename Runs>
+    auto drawEnsembleRuns(const X& x, const Runs& runs) -> DrawSpecs&;
+
+    /// Draw the empirical cumulative distribution function P(X <= x) of the given @p samples as a step curve.
+    /// The samples are sorted in parallel, tied values merged, and the curve reduced to the pixel resolution of the plot (or a coarser one fitting its point or latency budget) before it is written.
+    template <typename S>
+    auto drawECDF(const S& samples) -> DrawSpecs&;
+
+    /// Draw the complementary cumulative distribution function P(X >= x) of the given @p samples (e.g., latencies) as a step curve that ends at 1/n instead of zero.
+    /// If @p logaxes is true, the curve is reduced to the pixel resolution of log-log axes, to be combined with `plot.xtics().logscale()` and `plot.ytics().logscale()` so that its tail is drawn in full detail.
+    template <typename S>
+    auto drawCCDF(const S& samples, bool logaxes = true) -> DrawSpecs&;
+
     //======================================================================
     // METHODS FOR DRAWING PLOT ELEMENTS USING DATA FROM LOCAL FILES
     //======================================================================
@@ -289,6 +500,39 @@ class Plot2D : public Plot
 
     /// Convert this plot object into a gnuplot formatted string.
     auto repr() const -> std::string override;
+
+  private:
+    /// Draw the cumulative distribution of @p samples, or its complement, reduced to the pixel resolution of the plot (in log-log space if @p logaxes is true).
+    template <typename S>
+    auto drawDistribution(const S& samples, bool complementary, bool logaxes) -> DrawSpecs&;
+
+    /// Draw the given @p channels (one for palette images, three for RGB images) as an image with given @p use and @p with spanning [@p x0, @p x1] by [@p y0, @p y1], pooled as in @ref drawImage.
+    auto drawImageChannels(const std::vector<MatrixView>& channels, double x0, double x1, double y0, double y1, Pooling pooling, const std::string& use, const std::string& with) -> DrawSpecs&;
+
+    /// Draw the contours at the given @p levels of the field with values `valueat(j, i)` at `x[i]` and `y[j]` over the grid of @p x by @p y coordinates.
+    template <typename X, typename Y, typename ValueFn>
+    auto drawContoursWith(const X& x, const Y& y, const ValueFn& valueat, const std::vector<double>& levels) -> DrawSpecs&;
+
+    /// Draw the median and percentile bands of an ensemble with @p numsteps steps at @p x, where `valueat(r, s)` is the value of run `r` at step `s`.
+    template <typename X, typename ValueFn>
+    auto drawEnsembleWith(const X& x, std::size_t numruns, std::size_t numsteps, bool runmajor, const ValueFn& valueat, std::vector<double> percentiles) -> DrawSpecs&;
+
+    /// Draw the box plot of the given @p boxes summarizing @p rowsin values, subsampling their outliers to fit the budget of the plot.
+    auto drawBoxSummaries(const std::vector<BoxSummary>& boxes, std::size_t rowsin) -> DrawSpecs&;
+
+    /// Draw the hexagonal bins of @p size points at @p x and @p y with weights `weightat(i)`, on a grid of @p gridsize hexagons across *x* coarsened to fit the budget of the plot.
+    template <typename X, typename Y, typename WeightFn>
+    auto drawHexbinWith(const X& x, const Y& y, std::size_t size, std::size_t gridsize, const WeightFn& weightat) -> DrawSpecs&;
+
+    /// Draw the non-empty hexagons of @p layout as filled polygons colored by their @p counts, recording the statistics of the draw in @p stats.
+    auto drawHexagons(const internal::HexLayout& layout, const std::vector<double>& counts, DrawStats stats) -> DrawSpecs&;
+
+    /// Draw the envelope @p env aggregated from @p rowsin rows with given style, as a band between its bounds if the style is "filledcurves".
+    auto drawEnvelopeWith(const std::string& with, std::size_t rowsin, const internal::EnvelopeData& env) -> DrawSpecs&;
+
+    /// Write the given vectors as a new data set, draw it with given style and record its statistics in @p stats.
+    template <typename X, typename... Vecs>
+    auto writeWithVecs(DrawStats stats, const std::string& with, const X&, const Vecs&... vecs) -> DrawSpecs&;
 };
 
 inline Plot2D::Plot2D()
@@ -303,6 +547,49 @@ inline Plot2D::Plot2D()
 template <typename X, typename... Vecs>
 inline auto Plot2D::drawWithVecs(const std::string& with, const X& x, const Vecs&... vecs) -> DrawSpecs&
 {
+    DrawStats stats;
+    stats.with = with;
+    stats.rowsin = internal::minsize(x, vecs...);
+    stats.allowance = rowAllowance();
+
+    // Reduce curves exceeding the budget to the extrema of each pixel column (or of coarser columns if the budget is smaller than that)
+    if constexpr (sizeof...(Vecs) == 1 && !internal::isStringVector<X> && !(internal::isStringVector<Vecs> || ...))
+    {
+        const auto& y = std::get<0>(std::forward_as_tuple(vecs...));
+        const auto numcolumns = std::min(pixelsX(), stats.allowance / 4);
+        if (stats.allowance && stats.rowsin > stats.allowance && (with == "lines" || with == "impulses" || with == "filledcurves"))
+        {
+            const auto indices = internal::m4indices(x, y, stats.rowsin, numcolumns, stats.allowance);
+            return writeWithVecs(stats, with, internal::gather(x, indices), internal::gather(y, indices));
+        }
+        // Step curves hold each value until the next row, so repeated values can be dropped without changing the plot (except next to the ends, see internal::runindices)
+        if (with == "steps" || with == "fsteps" || with == "histeps" || with == "fillsteps")
+        {
+            const auto indices = internal::stepindices(x, y, stats.rowsin, numcolumns, stats.allowance);
+            if (indices.size() < stats.rowsin)
+                return writeWithVecs(stats, with, internal::gather(x, indices), internal::gather(y, indices));
+        }
+    }
+
+    return writeWithVecs(stats, with, x, vecs...);
+}
+
+inline auto Plot2D::drawEnvelopeWith(const std::string& with, std::size_t rowsin, const internal::EnvelopeData& env) -> DrawSpecs&
+{
+    DrawStats stats;
+    stats.with = with;
+    stats.rowsin = rowsin;
+    stats.allowance = rowAllowance();
+    if (with == "filledcurves")
+        return writeWithVecs(stats, with, env.x, env.low, env.high);
+    return writeWithVecs(stats, with, env.x, env.y, env.low, env.high);
+}
+
+template <typename X, typename... Vecs>
+inline auto Plot2D::writeWithVecs(DrawStats stats, const std::string& with, const X& x, const Vecs&... vecs) -> DrawSpecs&
+{
+    const auto start = std::chrono::steady_clock::now();
+
     // Write the given vectors x and y as a new data set to the stream
     std::ostringstream datastream;
     gnuplot::writedataset(datastream, m_numdatasets, x, vecs...);
@@ -323,6 +610,9 @@ inline auto Plot2D::drawWithVecs(const std::string& with, const X& x, const Vecs
     // Append new data set to existing data
     m_data += datastream.str();
 
+    stats.rowsout = internal::minsize(x, vecs...);
+    recordDraw(stats, start);
+
     // Draw the data saved using a data set with index `m_numdatasets`. Increase number of data sets and set the line style specification (desired behavior is 1, 2, 3 (incrementing as new lines are plotted)).
     return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), use, with).lineStyle(static_cast<int>(m_drawspecs.size()));
 }
@@ -330,6 +620,14 @@ inline auto Plot2D::drawWithVecs(const std::string& with, const X& x, const Vecs
 template <typename X, typename... Vecs>
 inline auto Plot2D::drawWithVecsContainingNaN(std::string with, const X& x, const Vecs&... vecs) -> DrawSpecs&
 {
+    const auto start = std::chrono::steady_clock::now();
+
+    // Broken curves are never reduced, as their gaps would be lost, so every row is written
+    DrawStats stats;
+    stats.with = with;
+    stats.rowsin = stats.rowsout = internal::minsize(x, vecs...);
+    stats.allowance = rowAllowance();
+
     // Write the given vectors x and y as a new data set to the stream
     std::ostringstream datastream;
     gnuplot::writedataset(datastream, m_numdatasets, x, vecs...);
@@ -344,6 +642,8 @@ inline auto Plot2D::drawWithVecsContainingNaN(std::string with, const X& x, cons
     // Append new data set to existing data
     m_data += datastream.str();
 
+    recordDraw(stats, start);
+
     // Draw the data saved using a data set with index `m_numdatasets`. Increase number of data sets and set the line style specification (desired behavior is 1, 2, 3 (incrementing as new lines are plotted)).
     return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), use, with).lineStyle(static_cast<int>(m_drawspecs.size()));
 }
@@ -354,6 +654,23 @@ inline auto Plot2D::drawCurve(const X& x, const Y& y) -> DrawSpecs&
     return drawWithVecs("lines", x, y);
 }
 
+template <typename X, typename Y>
+inline auto Plot2D::drawCurve(const X& x, const Y& y, const Smoothing& smoothing) -> DrawSpecs&
+{
+    return drawWithVecs("lines", x, smoothing.apply(y));
+}
+
+inline auto Plot2D::drawCurve(const LevelOfDetail& lod) -> DrawSpecs&
+{
+    return drawCurve(lod, lod.xmin(), lod.xmax());
+}
+
+inline auto Plot2D::drawCurve(const LevelOfDetail& lod, double x0, double x1) -> DrawSpecs&
+{
+    const auto curve = lod.query(x0, x1, pixelsX());
+    return drawWithVecs("lines", curve.x, curve.y);
+}
+
 template <typename X, typename Y>
 inline auto Plot2D::drawCurveWithPoints(const X& x, const Y& y) -> DrawSpecs&
 {
@@ -480,10 +797,52 @@ inline auto Plot2D::drawErrorBarsXY(const X& x, const Y& y, const XL& xlow, cons
     return drawWithVecs("xyerrorbars", x, y, xlow, xhigh, ylow, yhigh);
 }
 
+template <typename X, typename Y, typename YD>
+inline auto Plot2D::drawErrorBarsYEnvelope(const X& x, const Y& y, const YD& ydelta) -> DrawSpecs&
+{
+    const auto env = internal::envelopedelta(x, y, ydelta, pixelsX());
+    return drawEnvelopeWith("yerrorbars", internal::minsize(x, y, ydelta), env);
+}
+
+template <typename X, typename Y, typename YL, typename YH>
+inline auto Plot2D::drawErrorBarsYEnvelope(const X& x, const Y& y, const YL& ylow, const YH& yhigh) -> DrawSpecs&
+{
+    const auto env = internal::envelope(x, y, ylow, yhigh, pixelsX());
+    return drawEnvelopeWith("yerrorbars", internal::minsize(x, y, ylow, yhigh), env);
+}
+
+template <typename X, typename Y, typename YD>
+inline auto Plot2D::drawCurveWithErrorBarsYEnvelope(const X& x, const Y& y, const YD& ydelta) -> DrawSpecs&
+{
+    const auto env = internal::envelopedelta(x, y, ydelta, pixelsX());
+    return drawEnvelopeWith("yerrorlines", internal::minsize(x, y, ydelta), env);
+}
+
+template <typename X, typename Y, typename YL, typename YH>
+inline auto Plot2D::drawCurveWithErrorBarsYEnvelope(const X& x, const Y& y, const YL& ylow, const YH& yhigh) -> DrawSpecs&
+{
+    const auto env = internal::envelope(x, y, ylow, yhigh, pixelsX());
+    return drawEnvelopeWith("yerrorlines", internal::minsize(x, y, ylow, yhigh), env);
+}
+
+template <typename X, typename Y, typename YD>
+inline auto Plot2D::drawErrorBandYEnvelope(const X& x, const Y& y, const YD& ydelta) -> DrawSpecs&
+{
+    const auto env = internal::envelopedelta(x, y, ydelta, pixelsX());
+    return drawEnvelopeWith("filledcurves", internal::minsize(x, y, ydelta), env);
+}
+
+template <typename X, typename Y, typename YL, typename YH>
+inline auto Plot2D::drawErrorBandYEnvelope(const X& x, const Y& y, const YL& ylow, const YH& yhigh) -> DrawSpecs&
+{
+    const auto env = internal::envelope(x, y, ylow, yhigh, pixelsX());
+    return drawEnvelopeWith("filledcurves", internal::minsize(x, y, ylow, yhigh), env);
+}
+
 template <typename X, typename Y>
 inline auto Plot2D::drawSteps(const X& x, const Y& y) -> DrawSpecs&
 {
-    return drawWithVecsStepsChangeFirstX(x, y);
+    return drawStepsChangeFirstX(x, y);
 }
 
 template <typename X, typename Y>
@@ -534,6 +893,700 @@ inline auto Plot2D::drawHistogram(const Y& y) -> DrawSpecs&
     return drawWithVecs("", y); // empty string because we rely on `set style data histograms` since relying `with histograms` is not working very well (e.g., empty key/lenged appearing in columnstacked mode).
 }
 
+template <typename S>
+inline auto Plot2D::drawBinnedHistogram(const S& samples, const Bins& bins) -> DrawSpecs&
+{
+    const auto [layout, counts] = internal::histogram(samples, internal::minsize(samples), bins, [](std::size_t) { return 1.0; });
+    return drawHistogramBins(layout.edges, counts);
+}
+
+template <typename S, typename W>
+inline auto Plot2D::drawBinnedHistogram(const S& samples, const W& weights, const Bins& bins) -> DrawSpecs&
+{
+    const auto [layout, counts] = internal::histogram(samples, internal::minsize(samples, weights), bins, [&](std::size_t i) { return weights[i]; });
+    return drawHistogramBins(layout.edges, counts);
+}
+
+inline auto Plot2D::drawHistogramBins(const std::vector<double>& edges, const std::vector<double>& counts) -> DrawSpecs&
+{
+    const auto numbins = std::min(counts.size(), edges.size() ? edges.size() - 1 : 0);
+    std::vector<double> centers(numbins);
+    std::vector<double> widths(numbins);
+    for (std::size_t i = 0; i < numbins; ++i)
+    {
+        centers[i] = 0.5 * (edges[i] + edges[i + 1]);
+        widths[i] = edges[i + 1] - edges[i];
+    }
+    return drawWithVecs("boxes", centers, counts, widths);
+}
+
+inline auto Plot2D::drawHistogram(const Histogram& histogram) -> DrawSpecs&
+{
+    return drawHistogramBins(histogram.edges(), histogram.counts());
+}
+
+inline auto Plot2D::drawStepsHistogram(const Histogram& histogram) -> DrawSpecs&
+{
+    // Steps through the left edges of the bins, repeating the last count at the right edge, follow the exact bin outlines even for bins of unequal widths
+    auto x = histogram.edges();
+    auto y = histogram.counts();
+    if (!y.empty())
+        y.push_back(y.back());
+    return drawWithVecs("steps", x, y);
+}
+
+template <typename X, typename Y>
+inline auto Plot2D::drawHistogram2D(const X& x, const Y& y, const Bins& binsx, const Bins& binsy) -> DrawSpecs&
+{
+    const auto [layoutx, layouty, counts] = internal::histogram2d(x, y, internal::minsize(x, y), binsx, binsy, [](std::size_t) { return 1.0; });
+    return drawHistogram2DBins(layoutx.edges, layouty.edges, counts);
+}
+
+template <typename X, typename Y, typename W>
+inline auto Plot2D::drawHistogram2D(const X& x, const Y& y, const W& weights, const Bins& binsx, const Bins& binsy) -> DrawSpecs&
+{
+    const auto [layoutx, layouty, counts] = internal::histogram2d(x, y, internal::minsize(x, y, weights), binsx, binsy, [&](std::size_t i) { return weights[i]; });
+    return drawHistogram2DBins(layoutx.edges, layouty.edges, counts);
+}
+
+inline auto Plot2D::drawHistogram2DBins(const std::vector<double>& edgesx, const std::vector<double>& edgesy, const std::vector<double>& counts) -> DrawSpecs&
+{
+    const auto nx = edgesx.size() ? edgesx.size() - 1 : 0;
+    const auto ny = std::min(edgesy.size() ? edgesy.size() - 1 : 0, nx ? counts.size() / nx : 0);
+    std::vector<double> centersx(nx);
+    std::vector<double> centersy(ny);
+    for (std::size_t i = 0; i < nx; ++i)
+        centersx[i] = 0.5 * (edgesx[i] + edgesx[i + 1]);
+    for (std::size_t j = 0; j < ny; ++j)
+        centersy[j] = 0.5 * (edgesy[j] + edgesy[j + 1]);
+
+    DrawStats stats;
+    stats.rowsin = nx * ny;
+    stats.allowance = rowAllowance();
+
+    // An image needs equally spaced pixels, and then a binary matrix is much cheaper to write and for gnuplot to read than text
+    if (nx > 1 && ny > 1 && internal::equallyspaced(edgesx) && internal::equallyspaced(edgesy))
+    {
+        // Average the counts of neighboring bins if there are more of them than the budget allows
+        const auto [mx, my] = internal::fitwithin(nx, ny, stats.allowance, true);
+        const auto pooled = mx < nx || my < ny;
+        const auto pooledx = pooled ? internal::meanpool(centersx, nx, 1, mx, 1) : centersx;
+        const auto pooledy = pooled ? internal::meanpool(centersy, ny, 1, my, 1) : centersy;
+        const auto pooledcounts = pooled ? internal::meanpool(counts, nx, ny, mx, my) : std::vector<double>();
+        const auto start = std::chrono::steady_clock::now();
+        auto bytes = gnuplot::binarymatrix(pooledx, pooledy, pooled ? pooledcounts : counts);
+        stats.with = "image";
+        stats.rowsout = mx * my;
+        recordDraw(stats, start, true);
+        return drawWithBinaryData(std::move(bytes), "binary matrix", "", "image");
+    }
+
+    // Otherwise, draw every bin as a box spanning its edges, filled with the palette color of its count
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<double> x, y, xlow, xhigh, ylow, yhigh, z;
+    for (std::size_t j = 0; j < ny; ++j)
+    {
+        for (std::size_t i = 0; i < nx; ++i)
+        {
+            x.push_back(centersx[i]);
+            y.push_back(centersy[j]);
+            xlow.push_back(edgesx[i]);
+            xhigh.push_back(edgesx[i + 1]);
+            ylow.push_back(edgesy[j]);
+            yhigh.push_back(edgesy[j + 1]);
+            z.push_back(counts[i + nx * j]);
+        }
+    }
+    std::ostringstream datastream;
+    gnuplot::writedataset(datastream, m_numdatasets, x, y, xlow, xhigh, ylow, yhigh, z);
+    m_data += datastream.str();
+    stats.with = "boxxyerror";
+    stats.rowsout = x.size();
+    recordDraw(stats, start);
+    return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), "1:2:3:4:5:6:7", "boxxyerror fillcolor palette");
+}
+
+template <typename X, typename Y>
+inline auto Plot2D::drawHexbin(const X& x, const Y& y, std::size_t gridsize) -> DrawSpecs&
+{
+    return drawHexbinWith(x, y, internal::minsize(x, y), gridsize, [](std::size_t) { return 1.0; });
+}
+
+template <typename X, typename Y, typename W>
+inline auto Plot2D::drawHexbin(const X& x, const Y& y, const W& weights, std::size_t gridsize) -> DrawSpecs&
+{
+    return drawHexbinWith(x, y, internal::minsize(x, y, weights), gridsize, [&](std::size_t i) { return weights[i]; });
+}
+
+template <typename X, typename Y, typename WeightFn>
+inline auto Plot2D::drawHexbinWith(const X& x, const Y& y, std::size_t size, std::size_t gridsize, const WeightFn& weightat) -> DrawSpecs&
+{
+    DrawStats stats;
+    stats.with = "filledcurves closed";
+    stats.rowsin = size;
+    stats.allowance = rowAllowance();
+
+    // Coarsen the grid until the vertices of the non-empty hexagons fit the budget, since their number shrinks at least as fast as the number of hexagons
+    // The points are binned only once, and every coarser grid merges the hexagons of this first one instead
+    const auto fine = internal::hexbin(x, y, size, gridsize, weightat);
+    auto binned = fine;
+    const auto numvertices = std::size(internal::HEXAGON_VERTICES);
+    while (stats.allowance && gridsize > 1)
+    {
+        const auto nonempty = static_cast<std::size_t>(binned.second.size() - std::count(binned.second.begin(), binned.second.end(), 0.0));
+        const auto rows = nonempty * numvertices;
+        if (rows <= stats.allowance)
+            break;
+        const auto coarser = static_cast<std::size_t>(gridsize * std::sqrt(static_cast<double>(stats.allowance) / static_cast<double>(rows)));
+        gridsize = std::max<std::size_t>(std::min(coarser, gridsize - 1), 1);
+        binned = internal::coarsenhexbin(fine.first, fine.second, gridsize);
+    }
+    return drawHexagons(binned.first, binned.second, stats);
+}
+
+inline auto Plot2D::drawHexagons(const internal::HexLayout& layout, const std::vector<double>& counts, DrawStats stats) -> DrawSpecs&
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    // Write all hexagons as closed polygons of one data set, separated by blank lines, with their count repeated at every vertex for the palette
+    std::vector<double> x, y, z;
+    std::vector<std::size_t> blockends;
+    for (std::size_t k = 0; k < counts.size(); ++k)
+    {
+        if (counts[k] == 0.0)
+            continue;
+        const auto [cx, cy] = layout.center(k);
+        for (const auto& vertex : internal::HEXAGON_VERTICES)
+        {
+            x.push_back(cx + vertex[0] * layout.dx);
+            y.push_back(cy + vertex[1] * layout.dy);
+            z.push_back(counts[k]);
+        }
+        blockends.push_back(x.size());
+    }
+    std::ostringstream datastream;
+    gnuplot::writeblockdataset(datastream, m_numdatasets, blockends, x, y, z);
+    m_data += datastream.str();
+    stats.rowsout = x.size();
+    recordDraw(stats, start);
+    return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), "1:2:3", "filledcurves closed fillcolor palette");
+}
+
+template <typename S>
+inline auto Plot2D::drawDensity(const S& samples, const Bandwidth& bandwidth) -> DrawSpecs&
+{
+    const auto [x, density] = internal::kde(samples, internal::minsize(samples), bandwidth, internal::DEFAULT_DENSITY_GRIDSIZE);
+    return drawCurve(x, density);
+}
+
+template <typename S>
+inline auto Plot2D::drawDensityFilled(const S& samples, const Bandwidth& bandwidth) -> DrawSpecs&
+{
+    const auto [x, density] = internal::kde(samples, internal::minsize(samples), bandwidth, internal::DEFAULT_DENSITY_GRIDSIZE);
+    return drawCurveFilled(x, density);
+}
+
+template <typename Columns>
+inline auto Plot2D::drawCorrelationMatrix(const Columns& columns, const std::vector<std::string>& labels) -> DrawSpecs&
+{
+    const auto n = static_cast<std::size_t>(columns.size());
+    const auto correlations = internal::correlationmatrix(columns);
+    std::vector<double> positions(n);
+    for (std::size_t i = 0; i < n; ++i)
+        positions[i] = i + 1.0;
+    xrange(0.5, n + 0.5);
+    yrange(n + 0.5, 0.5);
+    if (!labels.empty())
+    {
+        const auto m = std::min(n, labels.size());
+        const std::vector<double> at(positions.begin(), positions.begin() + m);
+        const std::vector<std::string> names(labels.begin(), labels.begin() + m);
+        xtics().at(at, names);
+        ytics().at(at, names);
+    }
+    const auto start = std::chrono::steady_clock::now();
+    auto bytes = gnuplot::binarymatrix(positions, positions, correlations);
+    DrawStats stats;
+    stats.with = "image";
+    stats.rowsin = stats.rowsout = n * n;
+    recordDraw(stats, start, true);
+    return drawWithBinaryData(std::move(bytes), "binary matrix", "", "image");
+}
+
+inline auto Plot2D::drawImage(const MatrixView& values, double x0, double x1, double y0, double y1, Pooling pooling) -> DrawSpecs&
+{
+    return drawImageChannels({values}, x0, x1, y0, y1, pooling, "1", "image");
+}
+
+inline auto Plot2D::drawRGBImage(const MatrixView& red, const MatrixView& green, const MatrixView& blue, double x0, double x1, double y0, double y1, Pooling pooling) -> DrawSpecs&
+{
+    return drawImageChannels({red, green, blue}, x0, x1, y0, y1, pooling, "1:2:3", "rgbimage");
+}
+
+template <typename X, typename Y, typename Z>
+inline auto Plot2D::drawContours(const X& x, const Y& y, const Z& z, const std::vector<double>& levels) -> DrawSpecs&
+{
+    return drawContoursWith(x, y, [&](std::size_t j, std::size_t i) { return z[j][i]; }, levels);
+}
+
+template <typename X, typename Y>
+inline auto Plot2D::drawContours(const X& x, const Y& y, const MatrixView& z, const std::vector<double>& levels) -> DrawSpecs&
+{
+    return drawContoursWith(x, y, z, levels);
+}
+
+inline auto Plot2D::drawContours(const MatrixView& z, double x0, double x1, double y0, double y1, const std::vector<double>& levels) -> DrawSpecs&
+{
+    return drawContoursWith(internal::gridpoints(x0, x1, z.cols()), internal::gridpoints(y0, y1, z.rows()), z, levels);
+}
+
+template <typename Function>
+inline auto Plot2D::drawFunction(const Function& f, double x0, double x1) -> DrawSpecs&
+{
+    return drawFunction(f, x0, x1, Executor());
+}
+
+template <typename Function>
+inline auto Plot2D::drawFunction(const Function& f, double x0, double x1, const Executor& executor) -> DrawSpecs&
+{
+    internal::Evaluations evaluations(executor);
+    const auto sampled = internal::adaptivesample(f, x0, x1, pixelsX(), pixelsY(), evaluations);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::ostringstream datastream;
+    gnuplot::writeblockdataset(datastream, m_numdatasets, sampled.blockends, sampled.x, sampled.y);
+    m_data += datastream.str();
+
+    DrawStats stats;
+    stats.with = "lines";
+    stats.rowsin = stats.rowsout = sampled.x.size();
+    evaluations.record(stats);
+    recordDraw(stats, start);
+    return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), "1:2", "lines").lineStyle(static_cast<int>(m_drawspecs.size()));
+}
+
+template <typename S>
+inline auto Plot2D::drawPowerSpectrum(const S& signal, double fs, std::size_t segment) -> DrawSpecs&
+{
+    const auto [frequencies, psd] = internal::powerspectrum(signal, internal::minsize(signal), fs, segment);
+    return drawCurve(frequencies, psd);
+}
+
+template <typename S>
+inline auto Plot2D::drawSpectrogram(const S& signal, double fs, std::size_t window, std::size_t hop) -> DrawSpecs&
+{
+    const auto spectra = internal::framespectra(signal, internal::minsize(signal), fs, window, hop);
+    if (spectra.numframes == 0)
+        throw std::invalid_argument("The signal of a spectrogram must be at least as long as its window.");
+    const auto nx = spectra.numframes;
+    const auto ny = spectra.frequencies.size();
+    std::vector<double> times(nx);
+    for (std::size_t f = 0; f < nx; ++f)
+        times[f] = (f * hop + 0.5 * window) / fs;
+
+    // Average the densities over the frames and frequencies sharing a pixel (or a coarser cell fitting the budget) before converting them to decibels
+    DrawStats stats;
+    stats.with = "image";
+    stats.rowsin = nx * ny;
+    stats.allowance = rowAllowance();
+    const auto [mx, my] = internal::fitwithin(std::min(nx, pixelsX()), std::min(ny, pixelsY()), stats.allowance, true);
+    auto power = internal::meanpool(spectra.power, nx, ny, mx, my);
+    for (auto& p : power)
+        p = p > 0.0 ? 10.0 * std::log10(p) : NaN;
+    const auto x = internal::meanpool(times, nx, 1, mx, 1);
+    const auto y = internal::meanpool(spectra.frequencies, ny, 1, my, 1);
+
+    const auto start = std::chrono::steady_clock::now();
+    auto bytes = gnuplot::binarymatrix(x, y, power);
+    stats.rowsout = mx * my;
+    recordDraw(stats, start, true);
+    return drawWithBinaryData(std::move(bytes), "binary matrix", "", "image");
+}
+
+template <typename X, typename Y>
+inline auto Plot2D::drawFit(const X& x, const Y& y, const FitModel& model) -> DrawSpecs&
+{
+    return drawFit(Fit(x, y, model));
+}
+
+inline auto Plot2D::drawFit(const Fit& fit) -> DrawSpecs&
+{
+    const auto numpoints = std::max<std::size_t>(pixelsX(), 2);
+    std::vector<double> x(numpoints), y(numpoints);
+    for (std::size_t i = 0; i < numpoints; ++i)
+    {
+        x[i] = fit.xmin() + (fit.xmax() - fit.xmin()) * i / (numpoints - 1);
+        y[i] = fit(x[i]);
+    }
+    return drawCurve(x, y);
+}
+
+inline auto Plot2D::drawFitConfidenceBand(const Fit& fit, double level) -> DrawSpecs&
+{
+    const auto numpoints = std::max<std::size_t>(pixelsX(), 2);
+    std::vector<double> x(numpoints), low(numpoints), high(numpoints);
+    for (std::size_t i = 0; i < numpoints; ++i)
+    {
+        x[i] = fit.xmin() + (fit.xmax() - fit.xmin()) * i / (numpoints - 1);
+        std::tie(low[i], high[i]) = fit.confidenceInterval(x[i], level);
+    }
+    return drawCurvesFilled(x, low, high);
+}
+
+template <typename Groups>
+inline auto Plot2D::drawViolin(const Groups& groups, const Bandwidth& bandwidth) -> DrawSpecs&
+{
+    DrawStats stats;
+    stats.with = "filledcurves closed";
+    stats.allowance = rowAllowance();
+    const auto numgroups = static_cast<std::size_t>(groups.size());
+    for (std::size_t g = 0; g < numgroups; ++g)
+        stats.rowsin += internal::minsize(groups[g]);
+
+    // Every violin writes both of its sides, so sample the densities more coarsely if the outlines of all violins exceed the budget
+    auto gridsize = internal::DEFAULT_DENSITY_GRIDSIZE;
+    if (stats.allowance && numgroups)
+        gridsize = std::clamp<std::size_t>(stats.allowance / (2 * numgroups), 2, gridsize);
+    const auto densities = internal::kdes(groups, bandwidth, gridsize);
+    auto maxdensity = 0.0;
+    for (const auto& [y, density] : densities)
+        for (auto d : density)
+            maxdensity = std::max(maxdensity, d);
+    const auto scale = maxdensity > 0.0 ? 0.5 * internal::DEFAULT_VIOLIN_WIDTH / maxdensity : 0.0;
+
+    // Every violin is a closed outline in its own block, going up its left side and back down its right side
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<double> xs, ys;
+    std::vector<std::size_t> blockends;
+    for (std::size_t g = 0; g < densities.size(); ++g)
+    {
+        const auto& [y, density] = densities[g];
+        if (y.empty())
+            continue;
+        const auto center = g + 1.0;
+        for (std::size_t k = 0; k < y.size(); ++k)
+        {
+            xs.push_back(center - scale * density[k]);
+            ys.push_back(y[k]);
+        }
+        for (auto k = y.size(); k-- > 0;)
+        {
+            xs.push_back(center + scale * density[k]);
+            ys.push_back(y[k]);
+        }
+        blockends.push_back(xs.size());
+    }
+    std::ostringstream datastream;
+    gnuplot::writeblockdataset(datastream, m_numdatasets, blockends, xs, ys);
+    m_data += datastream.str();
+    stats.rowsout = xs.size();
+    recordDraw(stats, start);
+    return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), "1:2", "filledcurves closed").lineStyle(static_cast<int>(m_drawspecs.size()));
+}
+
+template <typename Groups>
+inline auto Plot2D::drawBoxPlot(const Groups& groups, std::size_t maxoutliers) -> DrawSpecs&
+{
+    std::size_t rowsin = 0;
+    for (std::size_t g = 0; g < static_cast<std::size_t>(groups.size()); ++g)
+        rowsin += internal::minsize(groups[g]);
+    return drawBoxSummaries(internal::boxsummaries(groups, maxoutliers), rowsin);
+}
+
+inline auto Plot2D::drawBoxPlot(const std::vector<BoxSummary>& boxes) -> DrawSpecs&
+{
+    auto rowsin = boxes.size();
+    for (const auto& box : boxes)
+        rowsin += box.outliers.size();
+    return drawBoxSummaries(boxes, rowsin);
+}
+
+inline auto Plot2D::drawBoxSummaries(const std::vector<BoxSummary>& boxes, std::size_t rowsin) -> DrawSpecs&
+{
+    DrawStats stats;
+    stats.with = "candlesticks";
+    stats.rowsin = rowsin;
+    stats.allowance = rowAllowance();
+
+    // Every box takes one row, and the outliers of each box share what remains of the budget
+    const auto numboxes = boxes.size();
+    auto maxoutliers = std::numeric_limits<std::size_t>::max();
+    if (stats.allowance && numboxes)
+        maxoutliers = stats.allowance > numboxes ? (stats.allowance - numboxes) / numboxes : 0;
+
+    // One summary row per box, with the position and width of the box followed by the five numbers
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<double> x(numboxes), width(numboxes, internal::DEFAULT_BOXPLOT_BOXWIDTH), whiskerlow(numboxes), q1(numboxes), median(numboxes), q3(numboxes), whiskerhigh(numboxes);
+    std::vector<double> outlierx, outliery;
+    for (std::size_t i = 0; i < numboxes; ++i)
+    {
+        x[i] = i + 1.0;
+        whiskerlow[i] = boxes[i].whiskerlow;
+        q1[i] = boxes[i].q1;
+        median[i] = boxes[i].median;
+        q3[i] = boxes[i].q3;
+        whiskerhigh[i] = boxes[i].whiskerhigh;
+        for (auto v : internal::capoutliers(boxes[i].outliers, maxoutliers))
+        {
+            outlierx.push_back(x[i]);
+            outliery.push_back(v);
+        }
+    }
+    std::ostringstream datastream;
+    gnuplot::writedataset(datastream, m_numdatasets, x, width, whiskerlow, q1, median, q3, whiskerhigh);
+    m_data += datastream.str();
+    const auto summaries = "'" + m_datafilename + "' index " + internal::str(m_numdatasets++);
+
+    // Draw the boxes (unfilled, so that the medians stay visible), then their medians as degenerate boxes, then the outliers, all with the line style of the boxes
+    const auto index = m_drawspecs.size();
+    const auto style = static_cast<int>(index + 1);
+    draw(summaries, "1:4:3:7:6:2", "candlesticks whiskerbars").lineStyle(style).fillEmpty();
+    draw(summaries, "1:5:5:5:5:2", "candlesticks").lineStyle(style).labelNone();
+    if (!outlierx.empty())
+    {
+        std::ostringstream outlierstream;
+        gnuplot::writedataset(outlierstream, m_numdatasets, outlierx, outliery);
+        m_data += outlierstream.str();
+        draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), "1:2", "points").lineStyle(style).labelNone();
+    }
+    stats.rowsout = numboxes + outlierx.size();
+    recordDraw(stats, start);
+    return m_drawspecs[index];
+}
+
+inline auto Plot2D::drawBoxPlot(const std::vector<QuantileSketch>& sketches) -> DrawSpecs&
+{
+    std::vector<BoxSummary> boxes;
+    boxes.reserve(sketches.size());
+    for (const auto& sketch : sketches)
+        boxes.push_back(sketch.boxSummary());
+    return drawBoxPlot(boxes);
+}
+
+template <typename X>
+inline auto Plot2D::drawQuantileBand(const X& x, const std::vector<QuantileSketch>& sketches, double plow, double phigh) -> DrawSpecs&
+{
+    std::vector<double> low(sketches.size());
+    std::vector<double> high(sketches.size());
+    for (std::size_t i = 0; i < sketches.size(); ++i)
+    {
+        low[i] = sketches[i].quantile(plow);
+        high[i] = sketches[i].quantile(phigh);
+    }
+    return drawCurvesFilled(x, low, high);
+}
+
+template <typename X, typename Runs>
+inline auto Plot2D::drawEnsemble(const X& x, const Runs& runs, std::vector<double> percentiles) -> DrawSpecs&
+{
+    const auto numsteps = internal::minsize(x);
+    const auto valueat = [&](std::size_t r, std::size_t s) { return s < internal::minsize(runs[r]) ? static_cast<double>(runs[r][s]) : NaN; };
+    return drawEnsembleWith(x, static_cast<std::size_t>(runs.size()), numsteps, true, valueat, std::move(percentiles));
+}
+
+template <typename X>
+inline auto Plot2D::drawEnsemble(const X& x, const std::vector<double>& values, std::size_t numruns, MatrixLayout layout, std::vector<double> percentiles) -> DrawSpecs&
+{
+    const auto length = numruns ? values.size() / numruns : 0;
+    const auto numsteps = std::min(internal::minsize(x), length);
+    if (layout == MatrixLayout::rowmajor)
+        return drawEnsembleWith(x, numruns, numsteps, true, [&](std::size_t r, std::size_t s) { return values[r * length + s]; }, std::move(percentiles));
+    return drawEnsembleWith(x, numruns, numsteps, false, [&](std::size_t r, std::size_t s) { return values[s * numruns + r]; }, std::move(percentiles));
+}
+
+template <typename X, typename ValueFn>
+inline auto Plot2D::drawEnsembleWith(const X& x, std::size_t numruns, std::size_t numsteps, bool runmajor, const ValueFn& valueat, std::vector<double> percentiles) -> DrawSpecs&
+{
+    // Compute the median together with all percentiles, which are split into those below it and those above it, paired from the outside in
+    percentiles.push_back(50.0);
+    std::sort(percentiles.begin(), percentiles.end());
+    percentiles.erase(std::unique(percentiles.begin(), percentiles.end()), percentiles.end());
+    const auto median = static_cast<std::size_t>(std::find(percentiles.begin(), percentiles.end(), 50.0) - percentiles.begin());
+    if (median != percentiles.size() - median - 1)
+        throw std::invalid_argument("The percentiles of an ensemble must pair up around the median, with as many below 50 as above it.");
+
+    // Every step takes one row, so compute the percentiles at evenly spread steps only if there are more steps than the budget allows
+    DrawStats stats;
+    stats.with = "lines";
+    stats.rowsin = numruns * numsteps;
+    stats.allowance = rowAllowance();
+    const auto numrows = stats.allowance ? std::min(numsteps, stats.allowance) : numsteps;
+    std::vector<std::size_t> steps(numrows);
+    for (std::size_t k = 0; k < numrows; ++k)
+        steps[k] = numrows < numsteps ? k * (numsteps - 1) / std::max<std::size_t>(numrows - 1, 1) : k;
+    const auto values = internal::ensemblepercentiles(numruns, numrows, runmajor, [&](std::size_t r, std::size_t k) { return valueat(r, steps[k]); }, percentiles);
+
+    // Write a single data set with x, the median and the percentiles in ascending order
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::vector<double>> columns(1, internal::gather(x, steps));
+    columns.insert(columns.end(), values.begin(), values.end());
+    std::ostringstream datastream;
+    gnuplot::writecolumns(datastream, m_numdatasets, columns);
+    m_data += datastream.str();
+    stats.rowsout = numrows;
+    recordDraw(stats, start);
+    const auto what = "'" + m_datafilename + "' index " + internal::str(m_numdatasets++);
+
+    // Draw the bands from the outermost to the innermost, overlapping transparently, and the median over them, all with the line style of the median
+    const auto style = static_cast<int>(m_drawspecs.size() + 1);
+    for (std::size_t k = 0; k < median; ++k)
+    {
+        const auto high = percentiles.size() - 1 - k;
+        draw(what, "1:" + internal::str(k + 2) + ":" + internal::str(high + 2), "filledcurves").lineStyle(style).fillTransparent().fillIntensity(0.25).labelNone();
+    }
+    return draw(what, "1:" + internal::str(median + 2), "lines").lineStyle(style);
+}
+
+template <typename X, typename Runs>
+inline auto Plot2D::drawEnsembleRuns(const X& x, const Runs& runs) -> DrawSpecs&
+{
+    DrawStats stats;
+    stats.with = "lines";
+    stats.allowance = rowAllowance();
+    const auto numruns = static_cast<std::size_t>(runs.size());
+    for (const auto& run : runs)
+        stats.rowsin += internal::minsize(x, run);
+
+    // Every run is a block of the data set, so that gnuplot draws them as separate curves of a single plot element, reduced like a curve to its share of the budget
+    const auto maxrows = numruns ? std::max<std::size_t>(stats.allowance / numruns, 4) : 0;
+    const auto numcolumns = std::min(pixelsX(), maxrows / 4);
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<double> xs, ys;
+    std::vector<std::size_t> blockends;
+    for (const auto& run : runs)
+    {
+        const auto size = internal::minsize(x, run);
+        if (stats.allowance && size > maxrows)
+        {
+            for (auto s : internal::m4indices(x, run, size, numcolumns, maxrows))
+            {
+                xs.push_back(static_cast<double>(x[s]));
+                ys.push_back(static_cast<double>(run[s]));
+            }
+        }
+        else
+        {
+            for (std::size_t s = 0; s < size; ++s)
+            {
+                xs.push_back(static_cast<double>(x[s]));
+                ys.push_back(static_cast<double>(run[s]));
+            }
+        }
+        blockends.push_back(xs.size());
+    }
+    std::ostringstream datastream;
+    gnuplot::writeblockdataset(datastream, m_numdatasets, blockends, xs, ys);
+    m_data += datastream.str();
+    stats.rowsout = xs.size();
+    recordDraw(stats, start);
+    return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), "1:2", "lines").lineStyle(static_cast<int>(m_drawspecs.size()));
+}
+
+template <typename S>
+inline auto Plot2D::drawECDF(const S& samples) -> DrawSpecs&
+{
+    return drawDistribution(samples, false, false);
+}
+
+template <typename S>
+inline auto Plot2D::drawCCDF(const S& samples, bool logaxes) -> DrawSpecs&
+{
+    return drawDistribution(samples, true, logaxes);
+}
+
+inline auto Plot2D::drawImageChannels(const std::vector<MatrixView>& channels, double x0, double x1, double y0, double y1, Pooling pooling, const std::string& use, const std::string& with) -> DrawSpecs&
+{
+    auto nx = channels.front().cols();
+    auto ny = channels.front().rows();
+    for (const auto& channel : channels)
+    {
+        nx = std::min(nx, channel.cols());
+        ny = std::min(ny, channel.rows());
+    }
+    if (nx == 0 || ny == 0)
+        throw std::invalid_argument("An image must have at least one row and one column.");
+
+    DrawStats stats;
+    stats.with = with;
+    stats.rowsin = nx * ny;
+    stats.allowance = rowAllowance();
+
+    // Write small images straight from the given views, and reduce larger ones to one entry per pixel (or per coarser cell fitting the budget) first if pooling is requested
+    const auto [mx, my] = pooling == Pooling::none ? std::make_pair(nx, ny) : internal::fitwithin(std::min(nx, pixelsX()), std::min(ny, pixelsY()), stats.allowance, true);
+    std::vector<std::vector<double>> pooled;
+    if (mx < nx || my < ny)
+        for (const auto& channel : channels)
+            pooled.push_back(internal::pool(channel, nx, ny, mx, my, pooling));
+    const auto start = std::chrono::steady_clock::now();
+    std::string bytes;
+    if (pooled.empty())
+        bytes = gnuplot::binaryarrayof(nx, ny, channels.size(), [&](std::size_t j, std::size_t i, std::size_t c) { return channels[c](j, i); });
+    else
+        bytes = gnuplot::binaryarrayof(mx, my, channels.size(), [&, mx = mx](std::size_t j, std::size_t i, std::size_t c) { return pooled[c][j * mx + i]; });
+
+    // The origin is the center of the bottom-left pixel, and every pixel spans dx by dy
+    const auto dx = (x1 - x0) / mx;
+    const auto dy = (y1 - y0) / my;
+    std::string format;
+    for (std::size_t c = 0; c < channels.size(); ++c)
+        format += "%float32";
+    const auto binary = "binary array=(" + internal::str(mx) + "," + internal::str(my) + ") format='" + format + "'"
+        + " origin=(" + internal::strexact(x0 + 0.5 * dx) + "," + internal::strexact(y0 + 0.5 * dy) + ")"
+        + " dx=" + internal::strexact(dx) + " dy=" + internal::strexact(dy);
+
+    stats.rowsout = mx * my;
+    recordDraw(stats, start, true);
+    return drawWithBinaryData(std::move(bytes), binary, use, with);
+}
+
+template <typename X, typename Y, typename ValueFn>
+inline auto Plot2D::drawContoursWith(const X& x, const Y& y, const ValueFn& valueat, const std::vector<double>& levels) -> DrawSpecs&
+{
+    const auto nx = internal::minsize(x);
+    const auto ny = internal::minsize(y);
+    const auto isolines = internal::isolines(x, y, nx, ny, valueat, levels);
+
+    // Write the polylines of all levels as the blocks of one data set, with the level repeated at every vertex for the palette
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<double> px, py, pz;
+    std::vector<std::size_t> blockends;
+    for (std::size_t l = 0; l < levels.size(); ++l)
+    {
+        const auto offset = px.size();
+        px.insert(px.end(), isolines[l].x.begin(), isolines[l].x.end());
+        py.insert(py.end(), isolines[l].y.begin(), isolines[l].y.end());
+        pz.resize(px.size(), levels[l]);
+        for (const auto end : isolines[l].blockends)
+            blockends.push_back(offset + end);
+    }
+    std::ostringstream datastream;
+    gnuplot::writeblockdataset(datastream, m_numdatasets, blockends, px, py, pz);
+    m_data += datastream.str();
+
+    DrawStats stats;
+    stats.with = "lines";
+    stats.rowsin = nx * ny;
+    stats.rowsout = px.size();
+    recordDraw(stats, start);
+    return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), "1:2:3", "lines linecolor palette");
+}
+
+template <typename S>
+inline auto Plot2D::drawDistribution(const S& samples, bool complementary, bool logaxes) -> DrawSpecs&
+{
+    // P(X <= x) holds its value from x onwards (steps), while P(X >= x) reaches its value at x (fsteps)
+    DrawStats stats;
+    stats.with = complementary ? "fsteps" : "steps";
+    stats.rowsin = internal::minsize(samples);
+    stats.allowance = rowAllowance();
+
+    // A monotone curve crosses at most as many pixels as there are columns and rows, so a coarser grid of pixels fits any budget
+    const auto [x, p] = internal::ecdf(samples, stats.rowsin, complementary);
+    const auto [numcolumns, numrows] = internal::fitwithin(pixelsX(), pixelsY(), stats.allowance, false);
+    const auto indices = internal::monotoneindices(x, p, x.size(), numcolumns, numrows, logaxes, logaxes);
+    return writeWithVecs(stats, stats.with, internal::gather(x, indices), internal::gather(p, indices));
+}
+
 //======================================================================
 // METHODS FOR DRAWING PLOT ELEMENTS USING DATA FROM LOCAL FILES
 //======================================================================
@@ -26,17 +26,28 @@
 #pragma once
 
 // C++ includes
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <limits>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 
 // sciplot includes
 #include <sciplot/Constants.hpp>
+#include <sciplot/Decimation.hpp>
 #include <sciplot/Default.hpp>
 #include <sciplot/Enums.hpp>
+#include <sciplot/Isosurface.hpp>
+#include <sciplot/MatrixView.hpp>
+#include <sciplot/MeshDecimation.hpp>
 #include <sciplot/Palettes.hpp>
 #include <sciplot/Plot.hpp>
+#include <sciplot/Sampling.hpp>
 #include <sciplot/StringOrDouble.hpp>
 #include <sciplot/Utils.hpp>
+#include <sciplot/VolumeView.hpp>
 #include <sciplot/specs/AxisLabelSpecs.hpp>
 #include <sciplot/specs/BorderSpecs.hpp>
 #include <sciplot/specs/DrawSpecs.hpp>
@@ -98,6 +109,57 @@ class Plot3D : public Plot
     template <typename Y>
     auto drawHistogram(const Y& y) -> DrawSpecs&;
 
+    /// Draw the surface with heights @p z (e.g., a vector of rows, with `z[j][i]` the height at `x[i]` and `y[j]`) over the grid of @p x by @p y coordinates, colored with the palette of the plot.
+    /// The grid is written as a binary nonuniform matrix (one 32-bit float per node) and drawn with `pm3d`, averaged over neighboring nodes if it has more of them than the point or latency budget of the plot allows.
+    template <typename X, typename Y, typename Z>
+    auto drawSurface(const X& x, const Y& y, const Z& z) -> DrawSpecs&;
+
+    /// Draw the surface with heights @p z (with `z(j, i)` the height at `x[i]` and `y[j]`) over the grid of @p x by @p y coordinates, reading @p z through its strides without copying it.
+    template <typename X, typename Y>
+    auto drawSurface(const X& x, const Y& y, const MatrixView& z) -> DrawSpecs&;
+
+    /// Draw the surface with heights @p z over the uniform grid spanning [@p x0, @p x1] along its columns and [@p y0, @p y1] along its rows.
+    auto drawSurface(const MatrixView& z, double x0, double x1, double y0, double y1) -> DrawSpecs&;
+
+    /// Draw the surface with heights @p z (e.g., a vector of rows) over the grid of @p x by @p y coordinates as a mesh of lines, written as a binary nonuniform matrix.
+    template <typename X, typename Y, typename Z>
+    auto drawSurfaceMesh(const X& x, const Y& y, const Z& z) -> DrawSpecs&;
+
+    /// Draw the surface with heights @p z over the grid of @p x by @p y coordinates as a mesh of lines, reading @p z through its strides without copying it.
+    template <typename X, typename Y>
+    auto drawSurfaceMesh(const X& x, const Y& y, const MatrixView& z) -> DrawSpecs&;
+
+    /// Draw the surface with heights @p z over the uniform grid spanning [@p x0, @p x1] along its columns and [@p y0, @p y1] along its rows as a mesh of lines.
+    auto drawSurfaceMesh(const MatrixView& z, double x0, double x1, double y0, double y1) -> DrawSpecs&;
+
+    /// Draw the isosurface at @p isovalue of the field with values @p volume (with `volume(k, j, i)` the value at `x[i]`, `y[j]`, and `z[k]`) over the grid of @p x by @p y by @p z coordinates.
+    /// The surface is extracted natively with marching cubes, in parallel over slabs of the grid, as a mesh of triangles sharing their vertices, simplified according to @p decimation (not at all by default),
+    /// and drawn with `polygons` (use `plot.gnuplot("set pm3d depthorder")` to have gnuplot draw the farthest triangles first). The volume is read through its strides without copying it.
+    /// The triangles are written as a binary record of 32-bit floats with one scan line of three corners per triangle, since gnuplot cannot share vertices between polygons.
+    template <typename X, typename Y, typename Z>
+    auto drawIsosurface(const X& x, const Y& y, const Z& z, const VolumeView& volume, double isovalue, const MeshDecimation& decimation = MeshDecimation::none()) -> DrawSpecs&;
+
+    /// Draw the isosurface at @p isovalue of the field with values @p volume over the grid of its indices (with `volume(k, j, i)` the value at *x* = i, *y* = j, and *z* = k).
+    auto drawIsosurface(const VolumeView& volume, double isovalue, const MeshDecimation& decimation = MeshDecimation::none()) -> DrawSpecs&;
+
+    /// Draw the mesh of triangles with vertices at @p x, @p y, and @p z, where every three consecutive entries of @p triangles are the indices of the vertices of a triangle.
+    /// The mesh is first simplified according to @p decimation (not at all by default) by collapsing its edges in order of increasing quadric error, and the number of triangles given may be further
+    /// reduced to fit the point or latency budget of the plot. The triangle counts and the time spent are recorded in the render statistics of the plot.
+    /// Errors in screen pixels are relative to the resolution of the plot (see Plot::resolution), which is otherwise its size or a small default size.
+    /// @throws std::invalid_argument if the number of entries of @p triangles is not a multiple of three or any of them is not the index of a vertex.
+    template <typename X, typename Y, typename Z>
+    auto drawMesh(const X& x, const Y& y, const Z& z, const std::vector<std::size_t>& triangles, const MeshDecimation& decimation = MeshDecimation::none()) -> DrawSpecs&;
+
+    /// Draw the function @p f of *x* and *y* (any callable taking two numbers and returning one) as a mesh sampled on a grid of @p gridsize by @p gridsize points over [@p x0, @p x1] × [@p y0, @p y1], written as a binary matrix.
+    /// The grid points are evaluated in parallel when @p f is expensive enough, so @p f must be safe to call concurrently.
+    /// The number of evaluations and the time they took are recorded in @ref renderStats.
+    template <typename Function>
+    auto drawFunction(const Function& f, double x0, double x1, double y0, double y1, std::size_t gridsize = internal::DEFAULT_FUNCTION_GRIDSIZE) -> DrawSpecs&;
+
+    /// Draw the function @p f of *x* and *y* as a mesh sampled on a grid of @p gridsize by @p gridsize points, with the grid points evaluated by the given @p executor.
+    template <typename Function>
+    auto drawFunction(const Function& f, double x0, double x1, double y0, double y1, std::size_t gridsize, const Executor& executor) -> DrawSpecs&;
+
     //======================================================================
     // METHODS FOR DRAWING PLOT ELEMENTS USING DATA FROM LOCAL FILES
     //======================================================================
@@ -131,6 +193,13 @@ class Plot3D : public Plot
     auto repr() const -> std::string override;
 
   private:
+    /// Draw the grid of @p x by @p y coordinates with heights `valueat(j, i)` at `x[i]` and `y[j]`, written as a binary nonuniform matrix (averaged down to fit the budget of the plot), with given style.
+    template <typename X, typename Y, typename ValueFn>
+    auto drawMatrix(const X& x, const Y& y, const ValueFn& valueat, const std::string& with) -> DrawSpecs&;
+
+    /// Draw the triangles of the given @p input mesh with `polygons` after simplifying it according to @p decimation, recording @p rowsin as the number of data points it was computed from (see DrawStats::rowsin).
+    auto drawTriangles(const internal::TriangleMesh& input, std::size_t rowsin, const MeshDecimation& decimation) -> DrawSpecs&;
+
     std::string m_zrange; ///< The z-range of the plot as a gnuplot formatted string (e.g., "set yrange [0:1]")
     AxisLabelSpecs m_zlabel; ///< The label of the z-axis
 };
@@ -158,6 +227,8 @@ inline auto Plot3D::zrange(StringOrDouble min, StringOrDouble max) -> void
 template <typename X, typename... Vecs>
 inline auto Plot3D::drawWithVecs(const std::string& with, const X& x, const Vecs&... vecs) -> DrawSpecs&
 {
+    const auto start = std::chrono::steady_clock::now();
+
     // Write the given vectors x and y as a new data set to the stream
     std::ostringstream datastream;
     gnuplot::writedataset(datastream, m_numdatasets, x, vecs...);
@@ -178,6 +249,11 @@ inline auto Plot3D::drawWithVecs(const std::string& with, const X& x, const Vecs
     // Append new data set to existing data
     m_data += datastream.str();
 
+    DrawStats stats;
+    stats.with = with;
+    stats.rowsin = stats.rowsout = internal::minsize(x, vecs...);
+    recordDraw(stats, start);
+
     // Draw the data saved using a data set with index `m_numdatasets`. Increase number of data sets and set the line style specification (desired behavior is 1, 2, 3 (incrementing as new lines are plotted)).
     return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), use, with).lineStyle(static_cast<int>(m_drawspecs.size()));
 }
@@ -219,6 +295,172 @@ inline auto Plot3D::drawHistogram(const Y& y) -> DrawSpecs&
     return drawWithVecs("", y); // empty string because we rely on `set style data histograms` since relying `with histograms` is not working very well (e.g., empty key/lenged appearing in columnstacked mode).
 }
 
+template <typename Function>
+inline auto Plot3D::drawFunction(const Function& f, double x0, double x1, double y0, double y1, std::size_t gridsize) -> DrawSpecs&
+{
+    return drawFunction(f, x0, x1, y0, y1, gridsize, Executor());
+}
+
+template <typename Function>
+inline auto Plot3D::drawFunction(const Function& f, double x0, double x1, double y0, double y1, std::size_t gridsize, const Executor& executor) -> DrawSpecs&
+{
+    const auto n = std::max<std::size_t>(gridsize, 2);
+    const auto xs = internal::gridpoints(x0, x1, n);
+    const auto ys = internal::gridpoints(y0, y1, n);
+    internal::Evaluations evaluations(executor);
+    const auto z = internal::evaluategrid(f, xs, ys, evaluations);
+
+    auto& specs = drawMatrix(xs, ys, [&](std::size_t j, std::size_t i) { return z[j * n + i]; }, "lines");
+    evaluations.record(m_renderstats.draws.back());
+    return specs;
+}
+
+template <typename X, typename Y, typename Z>
+inline auto Plot3D::drawSurface(const X& x, const Y& y, const Z& z) -> DrawSpecs&
+{
+    return drawMatrix(x, y, [&](std::size_t j, std::size_t i) { return z[j][i]; }, "pm3d");
+}
+
+template <typename X, typename Y>
+inline auto Plot3D::drawSurface(const X& x, const Y& y, const MatrixView& z) -> DrawSpecs&
+{
+    return drawMatrix(x, y, z, "pm3d");
+}
+
+inline auto Plot3D::drawSurface(const MatrixView& z, double x0, double x1, double y0, double y1) -> DrawSpecs&
+{
+    return drawMatrix(internal::gridpoints(x0, x1, z.cols()), internal::gridpoints(y0, y1, z.rows()), z, "pm3d");
+}
+
+template <typename X, typename Y, typename Z>
+inline auto Plot3D::drawSurfaceMesh(const X& x, const Y& y, const Z& z) -> DrawSpecs&
+{
+    return drawMatrix(x, y, [&](std::size_t j, std::size_t i) { return z[j][i]; }, "lines");
+}
+
+template <typename X, typename Y>
+inline auto Plot3D::drawSurfaceMesh(const X& x, const Y& y, const MatrixView& z) -> DrawSpecs&
+{
+    return drawMatrix(x, y, z, "lines");
+}
+
+inline auto Plot3D::drawSurfaceMesh(const MatrixView& z, double x0, double x1, double y0, double y1) -> DrawSpecs&
+{
+    return drawMatrix(internal::gridpoints(x0, x1, z.cols()), internal::gridpoints(y0, y1, z.rows()), z, "lines");
+}
+
+template <typename X, typename Y, typename Z>
+inline auto Plot3D::drawIsosurface(const X& x, const Y& y, const Z& z, const VolumeView& volume, double isovalue, const MeshDecimation& decimation) -> DrawSpecs&
+{
+    const auto nx = std::min(internal::minsize(x), volume.cols());
+    const auto ny = std::min(internal::minsize(y), volume.rows());
+    const auto nz = std::min(internal::minsize(z), volume.layers());
+    const auto mesh = internal::isosurface(x, y, z, nx, ny, nz, volume, isovalue);
+    return drawTriangles(mesh, nx * ny * nz, decimation);
+}
+
+inline auto Plot3D::drawIsosurface(const VolumeView& volume, double isovalue, const MeshDecimation& decimation) -> DrawSpecs&
+{
+    const auto x = internal::gridpoints(0.0, volume.cols() - 1.0, volume.cols());
+    const auto y = internal::gridpoints(0.0, volume.rows() - 1.0, volume.rows());
+    const auto z = internal::gridpoints(0.0, volume.layers() - 1.0, volume.layers());
+    return drawIsosurface(x, y, z, volume, isovalue, decimation);
+}
+
+template <typename X, typename Y, typename Z>
+inline auto Plot3D::drawMesh(const X& x, const Y& y, const Z& z, const std::vector<std::size_t>& triangles, const MeshDecimation& decimation) -> DrawSpecs&
+{
+    const auto numvertices = internal::minsize(x, y, z);
+    internal::TriangleMesh mesh;
+    mesh.x.assign(std::begin(x), std::begin(x) + numvertices);
+    mesh.y.assign(std::begin(y), std::begin(y) + numvertices);
+    mesh.z.assign(std::begin(z), std::begin(z) + numvertices);
+    if (triangles.size() % 3 != 0)
+        throw std::invalid_argument("The vertex indices of a mesh must come in groups of three, one group per triangle.");
+    if (std::any_of(triangles.begin(), triangles.end(), [&](std::size_t v) { return v >= numvertices; }))
+        throw std::invalid_argument("The triangles of a mesh must only refer to vertices it has.");
+    mesh.triangles = triangles;
+    return drawTriangles(mesh, numvertices, decimation);
+}
+
+template <typename X, typename Y, typename ValueFn>
+inline auto Plot3D::drawMatrix(const X& x, const Y& y, const ValueFn& valueat, const std::string& with) -> DrawSpecs&
+{
+    const auto nx = internal::minsize(x);
+    const auto ny = internal::minsize(y);
+    DrawStats stats;
+    stats.with = with;
+    stats.rowsin = nx * ny;
+    stats.allowance = rowAllowance();
+
+    // Average the heights and coordinates of neighboring nodes if the grid has more of them than the budget allows
+    const auto [mx, my] = internal::fitwithin(nx, ny, stats.allowance, true);
+    const auto start = std::chrono::steady_clock::now();
+    std::string bytes;
+    if (mx == nx && my == ny)
+        bytes = gnuplot::binarymatrixof(x, y, valueat);
+    else
+    {
+        const auto xs = internal::pool([&](std::size_t, std::size_t i) { return static_cast<double>(x[i]); }, nx, 1, mx, 1, Pooling::mean);
+        const auto ys = internal::pool([&](std::size_t, std::size_t j) { return static_cast<double>(y[j]); }, ny, 1, my, 1, Pooling::mean);
+        bytes = gnuplot::binarymatrix(xs, ys, internal::pool(valueat, nx, ny, mx, my, Pooling::mean));
+    }
+    stats.rowsout = mx * my;
+    recordDraw(stats, start, true);
+    return drawWithBinaryData(std::move(bytes), "binary matrix", "1:2:3", with).lineStyle(static_cast<int>(m_drawspecs.size()));
+}
+
+inline auto Plot3D::drawTriangles(const internal::TriangleMesh& input, std::size_t rowsin, const MeshDecimation& decimation) -> DrawSpecs&
+{
+    DrawStats stats;
+    stats.with = "polygons";
+    stats.rowsin = rowsin;
+    stats.allowance = rowAllowance();
+    stats.facesin = input.numtriangles();
+
+    // Simplify the mesh down to the given number of triangles and those fitting the budget of the plot, and as long as it moves by less than the given number of pixels
+    const auto decimationstart = std::chrono::steady_clock::now();
+    auto maxfaces = decimation.maxfaces() ? decimation.maxfaces() : std::numeric_limits<std::size_t>::max();
+    if (stats.allowance)
+        maxfaces = std::min(maxfaces, std::max<std::size_t>(stats.allowance / 3, 1));
+    auto tolerance = -1.0;
+    if (decimation.maxpixels() > 0.0 && !input.x.empty())
+    {
+        const auto extent = [](const std::vector<double>& values) {
+            const auto [lo, hi] = std::minmax_element(values.begin(), values.end());
+            return *hi - *lo;
+        };
+        const auto size = std::max({extent(input.x), extent(input.y), extent(input.z)});
+        tolerance = decimation.maxpixels() * size / std::max(pixelsX(), pixelsY());
+    }
+    const auto decimate = tolerance >= 0.0 || maxfaces < stats.facesin;
+    const auto decimated = decimate ? internal::decimatemesh(input, maxfaces, tolerance) : internal::TriangleMesh();
+    const auto& mesh = decimate ? decimated : input;
+    stats.facesout = mesh.numtriangles();
+    stats.decimationseconds = internal::secondssince(decimationstart);
+
+    // Write the three corners of every triangle as a scan line of a binary record, which gnuplot reads as a block of its own, i.e. as one of the polygons it draws
+    const auto start = std::chrono::steady_clock::now();
+    const auto numtriangles = mesh.numtriangles();
+    stats.rowsout = 3 * numtriangles;
+    if (numtriangles == 0)
+    {
+        // A record cannot be empty, so an empty surface is an empty text data set instead
+        std::ostringstream datastream;
+        gnuplot::writeblockdataset(datastream, m_numdatasets, {}, mesh.x, mesh.y, mesh.z);
+        m_data += datastream.str();
+        recordDraw(stats, start);
+        return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), "1:2:3", "polygons").lineStyle(static_cast<int>(m_drawspecs.size()));
+    }
+    auto bytes = gnuplot::binaryarrayof(3, numtriangles, 3, [&](std::size_t t, std::size_t k, std::size_t c) {
+        const auto v = mesh.triangles[3 * t + k];
+        return c == 0 ? mesh.x[v] : c == 1 ? mesh.y[v] : mesh.z[v];
+    });
+    recordDraw(stats, start, true);
+    const auto binary = "binary record=(3," + internal::str(numtriangles) + ") format='%float32%float32%float32'";
+    return drawWithBinaryData(std::move(bytes), binary, "1:2:3", "polygons").lineStyle(static_cast<int>(m_drawspecs.size()));
+}
+
 //======================================================================
 // METHODS FOR DRAWING PLOT ELEMENTS USING DATA FROM LOCAL FILES
 //======================================================================
@@ -0,0 +1,455 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/Default.hpp>
+#include <sciplot/Parallel.hpp>
+#include <sciplot/Utils.hpp>
+
+namespace sciplot
+{
+
+/// The summary of a group of samples drawn as a box with whiskers: the quartiles, the most extreme samples within 1.5 interquartile ranges of the box, and the samples beyond.
+struct BoxSummary
+{
+    double whiskerlow = NaN;      ///< The smallest sample not below the first quartile by more than 1.5 interquartile ranges
+    double q1 = NaN;              ///< The first quartile
+    double median = NaN;          ///< The median
+    double q3 = NaN;              ///< The third quartile
+    double whiskerhigh = NaN;     ///< The largest sample not above the third quartile by more than 1.5 interquartile ranges
+    std::vector<double> outliers; ///< The samples beyond the whiskers, in ascending order (possibly a subsample of them)
+};
+
+namespace internal
+{
+
+/// Return the quantiles @p ps (in ascending order) of @p values, interpolated linearly between the closest ranks, rearranging @p values by selection instead of sorting.
+/// Every quantile is selected within the part of @p values not below the previous one, so that the total cost stays O(n) for a few quantiles.
+inline auto selectquantiles(std::vector<double>& values, const std::vector<double>& ps) -> std::vector<double>
+{
+    std::vector<double> quantiles(ps.size(), NaN);
+    const auto n = values.size();
+    if (n == 0)
+        return quantiles;
+    std::size_t first = 0;
+    for (std::size_t i = 0; i < ps.size(); ++i)
+    {
+        const auto position = std::clamp(ps[i], 0.0, 1.0) * (n - 1);
+        const auto k = std::max(static_cast<std::size_t>(position), first);
+        std::nth_element(values.begin() + first, values.begin() + k, values.end());
+        const auto lower = values[k];
+        const auto upper = k + 1 < n ? *std::min_element(values.begin() + k + 1, values.end()) : lower;
+        quantiles[i] = lower + (position - k) * (upper - lower);
+        first = k;
+    }
+    return quantiles;
+}
+
+/// Return the given @p outliers in ascending order, evenly subsampled down to @p maxoutliers of them (always keeping the most extreme ones).
+inline auto capoutliers(std::vector<double> outliers, std::size_t maxoutliers) -> std::vector<double>
+{
+    std::sort(outliers.begin(), outliers.end());
+    if (outliers.size() <= maxoutliers)
+        return outliers;
+    if (maxoutliers < 2)
+        return std::vector<double>(maxoutliers ? 1 : 0, outliers.back());
+    std::vector<double> kept(maxoutliers);
+    for (std::size_t i = 0; i < maxoutliers; ++i)
+        kept[i] = outliers[i * (outliers.size() - 1) / (maxoutliers - 1)];
+    return kept;
+}
+
+/// Return the box summary of the finite @p values (rearranged in the process), keeping at most @p maxoutliers outliers.
+inline auto boxsummary(std::vector<double>& values, std::size_t maxoutliers) -> BoxSummary
+{
+    values.erase(std::remove_if(values.begin(), values.end(), [](double v) { return !std::isfinite(v); }), values.end());
+    BoxSummary box;
+    if (values.empty())
+        return box;
+    const auto quartiles = selectquantiles(values, {0.25, 0.5, 0.75});
+    box.q1 = quartiles[0];
+    box.median = quartiles[1];
+    box.q3 = quartiles[2];
+    const auto low = box.q1 - 1.5 * (box.q3 - box.q1);
+    const auto high = box.q3 + 1.5 * (box.q3 - box.q1);
+    box.whiskerlow = box.q1;
+    box.whiskerhigh = box.q3;
+    std::vector<double> outliers;
+    for (auto v : values)
+    {
+        if (v < low || v > high)
+            outliers.push_back(v);
+        else
+        {
+            box.whiskerlow = std::min(box.whiskerlow, v);
+            box.whiskerhigh = std::max(box.whiskerhigh, v);
+        }
+    }
+    box.outliers = capoutliers(std::move(outliers), maxoutliers);
+    return box;
+}
+
+/// Return the distinct finite values of @p samples in ascending order together with their empirical cumulative probabilities P(X <= x),
+/// or their complementary probabilities P(X >= x) if @p complementary is true (which stay positive, so that they can be drawn on a logarithmic axis).
+/// The samples are sorted in parallel and tied values merged into a single row.
+template <typename S>
+auto ecdf(const S& samples, std::size_t size, bool complementary) -> std::pair<std::vector<double>, std::vector<double>>
+{
+    std::vector<double> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+        if (std::isfinite(static_cast<double>(samples[i])))
+            values.push_back(static_cast<double>(samples[i]));
+    parallelsort(values);
+    const auto n = static_cast<double>(values.size());
+    std::vector<double> x;
+    std::vector<double> p;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (i + 1 < values.size() && values[i + 1] == values[i])
+            continue;
+        x.push_back(values[i]);
+        p.push_back((i + 1) / n);
+    }
+    if (complementary)
+    {
+        // P(X >= x_k) is one minus P(X <= x_(k-1)), the probability of the previous distinct value
+        for (auto k = p.size(); k-- > 0;)
+            p[k] = 1.0 - (k > 0 ? p[k - 1] : 0.0);
+    }
+    return {std::move(x), std::move(p)};
+}
+
+/// The number of steps of an ensemble whose values are gathered together before their percentiles are selected.
+const auto ENSEMBLE_BLOCK_SIZE = 64;
+
+/// Return the values of the given @p percentiles (in percent, in ascending order) at every step of an ensemble of @p numruns runs of @p numsteps steps,
+/// where `valueat(r, s)` is the value of run `r` at step `s` (non-finite values are ignored). The result has one vector per percentile.
+/// The steps are processed in parallel, in blocks whose values are first gathered step by step into a buffer, reading the ensemble along
+/// its contiguous direction (along the steps of every run if @p runmajor is true, along the runs of every step otherwise).
+template <typename ValueFn>
+auto ensemblepercentiles(std::size_t numruns, std::size_t numsteps, bool runmajor, const ValueFn& valueat, const std::vector<double>& percentiles) -> std::vector<std::vector<double>>
+{
+    std::vector<double> ps(percentiles.size());
+    for (std::size_t i = 0; i < ps.size(); ++i)
+        ps[i] = percentiles[i] / 100.0;
+    std::vector<std::vector<double>> result(ps.size(), std::vector<double>(numsteps, NaN));
+    const auto numblocks = (numsteps + ENSEMBLE_BLOCK_SIZE - 1) / ENSEMBLE_BLOCK_SIZE;
+    const auto grain = std::max<std::size_t>(1, PARALLEL_GRAIN_SIZE / std::max<std::size_t>(numruns * ENSEMBLE_BLOCK_SIZE, 1));
+    parallelfor(numblocks, numthreads(numblocks, grain), [&](std::size_t blockbegin, std::size_t blockend, std::size_t) {
+        std::vector<double> buffer(ENSEMBLE_BLOCK_SIZE * numruns);
+        std::vector<double> values;
+        for (auto block = blockbegin; block < blockend; ++block)
+        {
+            const auto first = block * ENSEMBLE_BLOCK_SIZE;
+            const auto m = std::min<std::size_t>(ENSEMBLE_BLOCK_SIZE, numsteps - first);
+            if (runmajor)
+            {
+                for (std::size_t r = 0; r < numruns; ++r)
+                    for (std::size_t s = 0; s < m; ++s)
+                        buffer[s * numruns + r] = static_cast<double>(valueat(r, first + s));
+            }
+            else
+            {
+                for (std::size_t s = 0; s < m; ++s)
+                    for (std::size_t r = 0; r < numruns; ++r)
+                        buffer[s * numruns + r] = static_cast<double>(valueat(r, first + s));
+            }
+            for (std::size_t s = 0; s < m; ++s)
+            {
+                values.clear();
+                for (std::size_t r = 0; r < numruns; ++r)
+                    if (std::isfinite(buffer[s * numruns + r]))
+                        values.push_back(buffer[s * numruns + r]);
+                const auto quantiles = selectquantiles(values, ps);
+                for (std::size_t i = 0; i < ps.size(); ++i)
+                    result[i][first + s] = quantiles[i];
+            }
+        }
+    });
+    return result;
+}
+
+/// Return the box summaries of the given @p groups of samples, each computed on its own thread when there are several groups.
+template <typename Groups>
+auto boxsummaries(const Groups& groups, std::size_t maxoutliers) -> std::vector<BoxSummary>
+{
+    const auto numgroups = static_cast<std::size_t>(groups.size());
+    std::vector<BoxSummary> boxes(numgroups);
+    parallelfor(numgroups, numthreads(numgroups, 1), [&](std::size_t begin, std::size_t end, std::size_t) {
+        std::vector<double> values;
+        for (auto g = begin; g < end; ++g)
+        {
+            const auto& group = groups[g];
+            values.assign(std::begin(group), std::end(group));
+            boxes[g] = boxsummary(values, maxoutliers);
+        }
+    });
+    return boxes;
+}
+
+} // namespace internal
+
+/// The class used to estimate the quantiles of samples arriving in batches, with a memory footprint bounded by its compression whatever the number of samples.
+/// Sketches filled on different threads can be combined with @ref merge, so each thread can fill its own without locking.
+///
+/// The sketch is a merging t-digest: the samples are summarized by centroids (a mean and a weight) whose sizes are limited by the arcsine scale function,
+/// so that centroids near the extremes stay small. Quantiles near 0 and 1 are therefore estimated much more accurately than with equal-sized groups.
+/// A larger compression gives more centroids (about that many) and more accurate quantiles.
+class QuantileSketch
+{
+  public:
+    /// Construct a QuantileSketch object with given @p compression.
+    explicit QuantileSketch(double compression = internal::DEFAULT_SKETCH_COMPRESSION);
+
+    /// Add the given @p value with given @p weight to the sketch (non-finite values are ignored).
+    auto add(double value, double weight = 1.0) -> QuantileSketch&;
+
+    /// Add the given batch of @p samples to the sketch.
+    template <typename S>
+    auto add(const S& samples) -> QuantileSketch&;
+
+    /// Add the samples summarized by another sketch to this one.
+    auto merge(const QuantileSketch& other) -> QuantileSketch&;
+
+    /// Return the estimated quantile @p p (between 0 and 1) of the samples, or NaN if there are none.
+    auto quantile(double p) const -> double;
+
+    /// Return the sum of the weights of the samples.
+    auto count() const -> double;
+
+    /// Return the smallest sample.
+    auto min() const -> double { return m_min; }
+
+    /// Return the largest sample.
+    auto max() const -> double { return m_max; }
+
+    /// Return the box summary of the samples, where only the minimum and the maximum can be outliers since the other samples are not kept.
+    auto boxSummary() const -> BoxSummary;
+
+  private:
+    /// A group of samples summarized by their mean and total weight.
+    struct Centroid
+    {
+        double mean;   ///< The mean of the samples
+        double weight; ///< The sum of the weights of the samples
+    };
+
+    /// Return the centroids with the buffered samples merged into them.
+    auto centroids() const -> std::vector<Centroid>;
+
+    /// Merge the given @p centroids (in any order), respecting the size limits of the scale function, and return them in ascending order of their means.
+    /// The centroids are merged from the largest means down if @p descending is true.
+    auto compress(std::vector<Centroid> centroids, bool descending = false) const -> std::vector<Centroid>;
+
+    /// Return the quantile @p p of the samples summarized by the given @p centroids.
+    auto quantile(const std::vector<Centroid>& centroids, double p) const -> double;
+
+    /// The compression, bounding the number of centroids.
+    double m_compression;
+
+    /// The centroids in ascending order of their means.
+    std::vector<Centroid> m_centroids;
+
+    /// The samples (or centroids of merged sketches) not yet merged into the centroids.
+    std::vector<Centroid> m_buffer;
+
+    /// The number of times the buffered samples have been merged into the centroids.
+    std::size_t m_numcompressions = 0;
+
+    /// The smallest sample.
+    double m_min = NaN;
+
+    /// The largest sample.
+    double m_max = NaN;
+};
+
+inline QuantileSketch::QuantileSketch(double compression)
+    : m_compression(compression)
+{
+    if (!(compression >= 10.0))
+        throw std::invalid_argument("The compression of a quantile sketch must be at least 10.");
+}
+
+inline auto QuantileSketch::add(double value, double weight) -> QuantileSketch&
+{
+    if (!std::isfinite(value) || !(weight > 0.0))
+        return *this;
+    m_min = std::isnan(m_min) ? value : std::min(m_min, value);
+    m_max = std::isnan(m_max) ? value : std::max(m_max, value);
+    m_buffer.push_back({value, weight});
+    // Buffering several times the number of centroids amortizes the sorting in compress
+    if (m_buffer.size() >= 5 * static_cast<std::size_t>(m_compression))
+    {
+        m_buffer.insert(m_buffer.end(), m_centroids.begin(), m_centroids.end());
+        // Alternating the direction of the merges avoids drifting the means of the centroids towards one end
+        m_centroids = compress(std::move(m_buffer), m_numcompressions++ % 2);
+        m_buffer.clear();
+    }
+    return *this;
+}
+
+template <typename S>
+auto QuantileSketch::add(const S& samples) -> QuantileSketch&
+{
+    const auto size = internal::minsize(samples);
+    for (std::size_t i = 0; i < size; ++i)
+        add(static_cast<double>(samples[i]));
+    return *this;
+}
+
+inline auto QuantileSketch::merge(const QuantileSketch& other) -> QuantileSketch&
+{
+    auto others = other.centroids();
+    if (others.empty())
+        return *this;
+    m_min = std::isnan(m_min) ? other.m_min : std::min(m_min, other.m_min);
+    m_max = std::isnan(m_max) ? other.m_max : std::max(m_max, other.m_max);
+    others.insert(others.end(), m_buffer.begin(), m_buffer.end());
+    others.insert(others.end(), m_centroids.begin(), m_centroids.end());
+    m_centroids = compress(std::move(others), m_numcompressions++ % 2);
+    m_buffer.clear();
+    return *this;
+}
+
+inline auto QuantileSketch::centroids() const -> std::vector<Centroid>
+{
+    if (m_buffer.empty())
+        return m_centroids;
+    auto all = m_buffer;
+    all.insert(all.end(), m_centroids.begin(), m_centroids.end());
+    return compress(std::move(all));
+}
+
+inline auto QuantileSketch::compress(std::vector<Centroid> centroids, bool descending) const -> std::vector<Centroid>
+{
+    if (centroids.empty())
+        return centroids;
+    // The scale function is symmetric, so merging from the top only requires the centroids in the opposite order
+    std::sort(centroids.begin(), centroids.end(), [&](const Centroid& a, const Centroid& b) { return descending ? a.mean > b.mean : a.mean < b.mean; });
+    auto total = 0.0;
+    for (const auto& c : centroids)
+        total += c.weight;
+
+    // The arcsine scale function k(q) and its inverse, such that a centroid may span at most one unit of k
+    const auto scale = m_compression / (2.0 * PI);
+    const auto kofq = [&](double q) { return scale * std::asin(2.0 * std::clamp(q, 0.0, 1.0) - 1.0); };
+    const auto qofk = [&](double k) { return 0.5 * (1.0 + std::sin(std::min(k / scale, 0.5 * PI))); };
+
+    std::vector<Centroid> merged;
+    merged.push_back(centroids.front());
+    auto before = 0.0; // the weight of the centroids before the last one
+    auto limit = total * qofk(kofq(0.0) + 1.0);
+    for (std::size_t i = 1; i < centroids.size(); ++i)
+    {
+        auto& last = merged.back();
+        const auto& c = centroids[i];
+        if (before + last.weight + c.weight <= limit)
+        {
+            last.mean += (c.mean - last.mean) * c.weight / (last.weight + c.weight);
+            last.weight += c.weight;
+        }
+        else
+        {
+            before += last.weight;
+            limit = total * qofk(kofq(before / total) + 1.0);
+            merged.push_back(c);
+        }
+    }
+    if (descending)
+        std::reverse(merged.begin(), merged.end());
+    return merged;
+}
+
+inline auto QuantileSketch::count() const -> double
+{
+    auto total = 0.0;
+    for (const auto& c : m_centroids)
+        total += c.weight;
+    for (const auto& c : m_buffer)
+        total += c.weight;
+    return total;
+}
+
+inline auto QuantileSketch::quantile(double p) const -> double
+{
+    return quantile(centroids(), p);
+}
+
+inline auto QuantileSketch::quantile(const std::vector<Centroid>& centroids, double p) const -> double
+{
+    if (centroids.empty())
+        return NaN;
+    auto total = 0.0;
+    for (const auto& c : centroids)
+        total += c.weight;
+    const auto target = std::clamp(p, 0.0, 1.0) * total;
+    // Every centroid is taken to sit at the middle of the weight it spans, with the minimum and maximum at both ends
+    auto previousat = 0.0;
+    auto previousvalue = m_min;
+    auto cumulative = 0.0;
+    for (const auto& c : centroids)
+    {
+        const auto at = cumulative + 0.5 * c.weight;
+        if (target < at)
+            return previousvalue + (c.mean - previousvalue) * (target - previousat) / (at - previousat);
+        previousat = at;
+        previousvalue = c.mean;
+        cumulative += c.weight;
+    }
+    if (total > previousat)
+        return previousvalue + (m_max - previousvalue) * (target - previousat) / (total - previousat);
+    return m_max;
+}
+
+inline auto QuantileSketch::boxSummary() const -> BoxSummary
+{
+    BoxSummary box;
+    const auto summary = centroids();
+    if (summary.empty())
+        return box;
+    box.q1 = quantile(summary, 0.25);
+    box.median = quantile(summary, 0.5);
+    box.q3 = quantile(summary, 0.75);
+    box.whiskerlow = std::max(m_min, box.q1 - 1.5 * (box.q3 - box.q1));
+    box.whiskerhigh = std::min(m_max, box.q3 + 1.5 * (box.q3 - box.q1));
+    if (m_min < box.whiskerlow)
+        box.outliers.push_back(m_min);
+    if (m_max > box.whiskerhigh)
+        box.outliers.push_back(m_max);
+    return box;
+}
+
+} // namespace sciplot
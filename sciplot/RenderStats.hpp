@@ -0,0 +1,127 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Default.hpp>
+
+namespace sciplot
+{
+
+/// The statistics recorded for a single draw call with vector data.
+struct DrawStats
+{
+    std::string with;               ///< The plot style of the draw (e.g., "lines")
+    std::size_t rowsin = 0;         ///< The number of data points given to the draw call: entries of its vectors, nodes of its grids and volumes, or vertices of its meshes
+    std::size_t rowsout = 0;        ///< The number of rows written to the data file
+    std::size_t allowance = 0;      ///< The maximum number of rows allowed by the point or latency budget of the plot (zero if no budget is set)
+    double formatseconds = 0.0;     ///< The time spent formatting the written rows
+    double estimatedseconds = 0.0;  ///< The estimated time for formatting and rendering the written rows
+    std::size_t evaluations = 0;    ///< The number of evaluations of the function drawn (zero if the draw is not of a function)
+    double evaluationseconds = 0.0; ///< The wall time spent evaluating the function drawn
+    std::size_t facesin = 0;        ///< The number of triangles of the mesh drawn before decimation (zero if the draw is not of a mesh)
+    std::size_t facesout = 0;       ///< The number of triangles of the mesh drawn after decimation
+    double decimationseconds = 0.0; ///< The time spent decimating the mesh drawn
+};
+
+/// The statistics recorded while drawing and rendering plots.
+struct RenderStats
+{
+    std::vector<DrawStats> draws;  ///< The statistics of every draw call with vector data
+    double gnuplotseconds = 0.0;   ///< The time spent by gnuplot rendering the last saved or shown canvas
+
+    /// Return the total number of rows given to all draw calls.
+    auto rowsin() const -> std::size_t
+    {
+        std::size_t sum = 0;
+        for (const auto& draw : draws)
+            sum += draw.rowsin;
+        return sum;
+    }
+
+    /// Return the total number of rows written to the data files.
+    auto rowsout() const -> std::size_t
+    {
+        std::size_t sum = 0;
+        for (const auto& draw : draws)
+            sum += draw.rowsout;
+        return sum;
+    }
+};
+
+namespace internal
+{
+
+/// The estimated throughputs (in rows per second) used to convert a latency budget into a number of rows.
+struct Throughput
+{
+    std::atomic<double> format = DEFAULT_FORMAT_ROWS_PER_SECOND;   ///< The rate at which rows are formatted into the data file
+    std::atomic<double> gnuplot = DEFAULT_GNUPLOT_ROWS_PER_SECOND; ///< The rate at which gnuplot reads and renders rows
+};
+
+/// Return the throughput estimates shared by all plots, refined as draws are formatted and canvases are saved.
+inline auto throughput() -> Throughput&
+{
+    static Throughput instance;
+    return instance;
+}
+
+/// Update a throughput @p estimate with a new measurement of @p rows processed in @p seconds (small measurements are ignored as too noisy).
+inline auto calibrate(std::atomic<double>& estimate, std::size_t rows, double seconds) -> void
+{
+    if (rows < static_cast<std::size_t>(DEFAULT_CALIBRATION_MIN_ROWS) || seconds <= 0.0)
+        return;
+    estimate = 0.5 * estimate.load() + 0.5 * (static_cast<double>(rows) / seconds);
+}
+
+/// Return the estimated time (in seconds) needed to format and render the given number of @p rows.
+inline auto estimatedseconds(std::size_t rows) -> double
+{
+    return rows / throughput().format.load() + rows / throughput().gnuplot.load();
+}
+
+/// Return the number of rows that can be formatted and rendered within the given number of @p seconds.
+inline auto affordablerows(double seconds) -> std::size_t
+{
+    if (seconds <= 0.0)
+        return 0;
+    return static_cast<std::size_t>(seconds / estimatedseconds(1));
+}
+
+/// Return the time elapsed (in seconds) since @p start.
+inline auto secondssince(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -0,0 +1,314 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/Parallel.hpp>
+#include <sciplot/RenderStats.hpp>
+
+namespace sciplot
+{
+
+/// The type of the executors that evaluate the functions drawn by `drawFunction` in parallel (e.g., by submitting the tasks to a thread pool).
+/// An executor called with `size` and `task` must call `task(i)` exactly once for every `i` in [0, `size`), possibly concurrently, and return once all calls are done.
+/// The results are stored by index, so their order does not depend on the order in which the tasks run.
+using Executor = std::function<void(std::size_t size, const std::function<void(std::size_t)>& task)>;
+
+namespace internal
+{
+
+/// The minimum time (in seconds) worth of evaluations given to each thread when functions are evaluated without a user executor.
+const auto EVALUATION_MIN_THREAD_SECONDS = 1e-4;
+
+/// The evaluations of a function drawn by a plot, run in batches on a user @ref Executor or on as many threads as worthwhile.
+struct Evaluations
+{
+    /// Construct an Evaluations object running batches on @p executor, or on threads of its own if @p executor is empty.
+    explicit Evaluations(Executor executor = {})
+        : executor(std::move(executor)) {}
+
+    /// Call `task(i)` for every `i` in [0, @p size).
+    /// Without a user executor, a first evaluation is timed on the calling thread, and its cost decides how many threads the others are spread over.
+    template <typename Task>
+    auto run(std::size_t size, const Task& task) -> void
+    {
+        const auto start = std::chrono::steady_clock::now();
+        if (executor)
+            executor(size, task);
+        else if (size > 0)
+        {
+            std::size_t first = 0;
+            if (numevals == 0)
+            {
+                task(0);
+                cost = secondssince(start);
+                first = 1;
+            }
+            const auto remaining = size - first;
+            const auto worthwhile = static_cast<std::size_t>(remaining * cost / EVALUATION_MIN_THREAD_SECONDS);
+            parallelfor(remaining, std::max<std::size_t>(1, std::min(numthreads(remaining, 1), worthwhile)), [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (auto i = begin; i < end; ++i)
+                    task(first + i);
+            });
+        }
+        numevals += size;
+        seconds += secondssince(start);
+    }
+
+    /// Record the number of evaluations and the time they took in @p stats.
+    auto record(DrawStats& stats) const -> void
+    {
+        stats.evaluations = numevals;
+        stats.evaluationseconds = seconds;
+    }
+
+    /// The executor given by the user, if any.
+    Executor executor;
+
+    /// The number of evaluations run so far.
+    std::size_t numevals = 0;
+
+    /// The wall time (in seconds) spent evaluating so far.
+    double seconds = 0.0;
+
+    /// The time (in seconds) taken by the first evaluation, used as the cost of every evaluation.
+    double cost = 0.0;
+};
+
+/// Return the values of the function @p f of two variables on the grid of @p xs by @p ys, row after row (one row per *y*), evaluated with @p evaluations.
+template <typename Function>
+auto evaluategrid(const Function& f, const std::vector<double>& xs, const std::vector<double>& ys, Evaluations& evaluations) -> std::vector<double>
+{
+    std::vector<double> values(xs.size() * ys.size());
+    evaluations.run(values.size(), [&](std::size_t i) { values[i] = static_cast<double>(f(xs[i % xs.size()], ys[i / xs.size()])); });
+    return values;
+}
+
+/// The number of equal intervals a function is first sampled on, before they are subdivided where needed.
+const auto SAMPLING_INITIAL_INTERVALS = 64;
+
+/// The largest distance (in pixels) allowed between a sampled curve and the midpoint of any of its segments.
+const auto SAMPLING_PIXEL_TOLERANCE = 0.5;
+
+/// The width (in pixels) below which segments are no longer subdivided.
+const auto SAMPLING_MIN_PIXEL_WIDTH = 1.0 / 16.0;
+
+/// The vertical extent (in pixels) above which a segment is checked for a discontinuity.
+const auto SAMPLING_JUMP_PIXELS = 2.0;
+
+/// The maximum number of bisections used to tell a discontinuity from a steep but continuous segment.
+const auto SAMPLING_JUMP_BISECTIONS = 48;
+
+/// The points of a function sampled adaptively, split into continuous pieces.
+struct SampledFunction
+{
+    /// The *x* coordinates of the points, in increasing order.
+    std::vector<double> x;
+
+    /// The values of the function at the points.
+    std::vector<double> y;
+
+    /// The index one past the last point of every continuous piece.
+    std::vector<std::size_t> blockends;
+};
+
+/// Return the function @p f sampled adaptively over [@p x0, @p x1] for a plot of @p numcolumns by @p numrows pixels, evaluated in batches with @p evaluations.
+/// Starting from an equally spaced grid, every segment whose midpoint deviates from it by more than @ref SAMPLING_PIXEL_TOLERANCE is split, round after round, until segments are sub-pixel.
+/// Segments with a non-finite end are split to locate where the function stops being defined, and steep segments are bisected further to tell discontinuities,
+/// at which the curve is broken, from steep continuous parts. The points of every round are evaluated as one batch, so that they can be evaluated in parallel.
+template <typename Function>
+auto adaptivesample(const Function& f, double x0, double x1, std::size_t numcolumns, std::size_t numrows, Evaluations& evaluations) -> SampledFunction
+{
+    SampledFunction result;
+    if (!(x1 > x0))
+        return result;
+    const auto batch = [&](const std::vector<double>& xs) {
+        std::vector<double> ys(xs.size());
+        evaluations.run(xs.size(), [&](std::size_t i) { ys[i] = static_cast<double>(f(xs[i])); });
+        return ys;
+    };
+
+    std::vector<double> xs(SAMPLING_INITIAL_INTERVALS + 1);
+    for (std::size_t i = 0; i < xs.size(); ++i)
+        xs[i] = x0 + (x1 - x0) * i / SAMPLING_INITIAL_INTERVALS;
+    auto ys = batch(xs);
+
+    // The scales converting distances to pixels, with the vertical one based on the range of the initial samples
+    auto ymin = std::numeric_limits<double>::infinity();
+    auto ymax = -std::numeric_limits<double>::infinity();
+    for (auto y : ys)
+    {
+        if (std::isfinite(y))
+        {
+            ymin = std::min(ymin, y);
+            ymax = std::max(ymax, y);
+        }
+    }
+    const auto sx = numcolumns / (x1 - x0);
+    const auto sy = ymax > ymin ? numrows / (ymax - ymin) : 1.0;
+
+    // Subdivide the active segments round after round, evaluating all their midpoints in one batch
+    std::vector<char> active(xs.size() - 1, 1);
+    while (std::find(active.begin(), active.end(), 1) != active.end())
+    {
+        std::vector<double> xm;
+        for (std::size_t i = 0; i < active.size(); ++i)
+            if (active[i])
+                xm.push_back(0.5 * (xs[i] + xs[i + 1]));
+        const auto ym = batch(xm);
+        std::vector<double> nextxs{xs[0]}, nextys{ys[0]};
+        std::vector<char> nextactive;
+        for (std::size_t i = 0, k = 0; i < active.size(); ++i)
+        {
+            if (active[i])
+            {
+                const auto xa = xs[i], ya = ys[i], xb = xs[i + 1], yb = ys[i + 1], xc = xm[k], yc = ym[k];
+                ++k;
+                const auto finite = std::isfinite(ya) + std::isfinite(yb) + std::isfinite(yc);
+                auto split = false;
+                if (finite == 3)
+                {
+                    // The distance in pixels from the midpoint to the segment joining the ends
+                    const auto dx = (xb - xa) * sx, dy = (yb - ya) * sy;
+                    const auto ex = (xc - xa) * sx, ey = (yc - ya) * sy;
+                    split = std::abs(dx * ey - dy * ex) > SAMPLING_PIXEL_TOLERANCE * std::hypot(dx, dy);
+                }
+                else
+                    split = finite > 0;
+                split = split && (xb - xa) * sx > 2.0 * SAMPLING_MIN_PIXEL_WIDTH && xc > xa && xc < xb;
+                if (split)
+                {
+                    nextxs.push_back(xc);
+                    nextys.push_back(yc);
+                    nextactive.push_back(1);
+                }
+                nextactive.push_back(split);
+            }
+            else
+                nextactive.push_back(0);
+            nextxs.push_back(xs[i + 1]);
+            nextys.push_back(ys[i + 1]);
+        }
+        xs = std::move(nextxs);
+        ys = std::move(nextys);
+        active = std::move(nextactive);
+    }
+
+    // Bisect steep segments towards their steepest part, all in lockstep: the vertical extent of a continuous segment vanishes, that of a discontinuity does not
+    struct Jump
+    {
+        std::size_t segment;
+        double xa, ya, xb, yb;
+        bool decided = false;
+        bool continuous = false;
+    };
+    std::vector<Jump> jumps;
+    for (std::size_t i = 0; i + 1 < xs.size(); ++i)
+        if (std::isfinite(ys[i]) && std::isfinite(ys[i + 1]) && std::abs(ys[i + 1] - ys[i]) * sy > SAMPLING_JUMP_PIXELS)
+            jumps.push_back({i, xs[i], ys[i], xs[i + 1], ys[i + 1]});
+    for (auto round = 0; round < SAMPLING_JUMP_BISECTIONS; ++round)
+    {
+        std::vector<double> xm;
+        for (const auto& jump : jumps)
+            if (!jump.decided)
+                xm.push_back(0.5 * (jump.xa + jump.xb));
+        if (xm.empty())
+            break;
+        const auto ym = batch(xm);
+        std::size_t k = 0;
+        for (auto& jump : jumps)
+        {
+            if (jump.decided)
+                continue;
+            const auto xc = xm[k];
+            const auto yc = ym[k];
+            ++k;
+            // Stop where the function is undefined or the segment cannot be split any further, both of which break the curve
+            if (!std::isfinite(yc) || !(xc > jump.xa && xc < jump.xb))
+            {
+                jump.decided = true;
+                continue;
+            }
+            if (std::abs(yc - jump.ya) > std::abs(jump.yb - yc))
+            {
+                jump.xb = xc;
+                jump.yb = yc;
+            }
+            else
+            {
+                jump.xa = xc;
+                jump.ya = yc;
+            }
+            // The segment is continuous once its steepest part fits in a pixel
+            jump.continuous = std::abs(jump.yb - jump.ya) * sy <= 1.0;
+            jump.decided = jump.continuous;
+        }
+    }
+    jumps.erase(std::remove_if(jumps.begin(), jumps.end(), [](const Jump& jump) { return jump.continuous; }), jumps.end());
+
+    // Write the finite points piece by piece, ending a piece at undefined values and discontinuities
+    auto nextjump = jumps.begin();
+    const auto endpiece = [&] {
+        if (!result.x.empty() && (result.blockends.empty() || result.blockends.back() != result.x.size()))
+            result.blockends.push_back(result.x.size());
+    };
+    for (std::size_t i = 0; i < xs.size(); ++i)
+    {
+        if (!std::isfinite(ys[i]))
+        {
+            endpiece();
+            continue;
+        }
+        result.x.push_back(xs[i]);
+        result.y.push_back(ys[i]);
+        while (nextjump != jumps.end() && nextjump->segment < i)
+            ++nextjump;
+        if (nextjump != jumps.end() && nextjump->segment == i)
+        {
+            // Extend the curve up to both sides of the discontinuity before breaking it
+            result.x.push_back(nextjump->xa);
+            result.y.push_back(nextjump->ya);
+            endpiece();
+            result.x.push_back(nextjump->xb);
+            result.y.push_back(nextjump->yb);
+        }
+    }
+    endpiece();
+    return result;
+}
+
+} // namespace internal
+} // namespace sciplot
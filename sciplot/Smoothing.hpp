@@ -0,0 +1,280 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cmath>
+#include <deque>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/Parallel.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// The relative weight below which the contribution of old values to an exponentially weighted moving average is neglected at chunk boundaries.
+const auto EWMA_HALO_TOLERANCE = 1e-12;
+
+/// Write in @p out the means of the finite values of @p y in the windows [i - @p left, i + @p right] (truncated to [0, @p size)) for every i in [@p begin, @p end).
+/// The window sum is updated as it slides, so that every chunk costs O(end - begin + left + right). Windows without finite values produce NaN.
+template <typename Y>
+auto rollingmean(const Y& y, std::size_t size, std::size_t left, std::size_t right, std::size_t begin, std::size_t end, double* out) -> void
+{
+    auto sum = 0.0;
+    std::size_t count = 0;
+    auto first = begin > left ? begin - left : 0; // the first index inside the window
+    auto last = first;                             // one past the last index inside the window
+    for (auto i = begin; i < end; ++i)
+    {
+        for (; last < std::min(i + right + 1, size); ++last)
+        {
+            const auto v = static_cast<double>(y[last]);
+            if (std::isfinite(v))
+            {
+                sum += v;
+                ++count;
+            }
+        }
+        for (; first + left < i; ++first)
+        {
+            const auto v = static_cast<double>(y[first]);
+            if (std::isfinite(v))
+            {
+                sum -= v;
+                --count;
+            }
+            if (count == 0)
+                sum = 0.0; // drop the rounding errors accumulated so far
+        }
+        out[i - begin] = count ? sum / count : NaN;
+    }
+}
+
+/// Write in @p out the minima (or maxima if @p maximum is true) of the finite values of @p y in the windows [i - @p left, i + @p right] for every i in [@p begin, @p end).
+/// A monotonic deque of candidate indices makes every chunk cost O(end - begin + left + right).
+template <typename Y>
+auto rollingextreme(const Y& y, std::size_t size, std::size_t left, std::size_t right, std::size_t begin, std::size_t end, bool maximum, double* out) -> void
+{
+    const auto dominates = [&](double a, double b) { return maximum ? a >= b : a <= b; };
+    std::deque<std::size_t> candidates; // indices whose values are monotone from the front (the extreme) to the back
+    auto last = begin > left ? begin - left : 0;
+    for (auto i = begin; i < end; ++i)
+    {
+        for (; last < std::min(i + right + 1, size); ++last)
+        {
+            const auto v = static_cast<double>(y[last]);
+            if (!std::isfinite(v))
+                continue;
+            while (!candidates.empty() && dominates(v, static_cast<double>(y[candidates.back()])))
+                candidates.pop_back();
+            candidates.push_back(last);
+        }
+        while (!candidates.empty() && candidates.front() + left < i)
+            candidates.pop_front();
+        out[i - begin] = candidates.empty() ? NaN : static_cast<double>(y[candidates.front()]);
+    }
+}
+
+/// Write in @p out the medians of the finite values of @p y in the windows [i - @p left, i + @p right] for every i in [@p begin, @p end).
+/// The window is kept split in two balanced ordered halves, so that every chunk costs O((end - begin + left + right) log(left + right)).
+template <typename Y>
+auto rollingmedian(const Y& y, std::size_t size, std::size_t left, std::size_t right, std::size_t begin, std::size_t end, double* out) -> void
+{
+    std::multiset<double> low;  // the smaller half of the window, with one more value than high if the window size is odd
+    std::multiset<double> high; // the larger half of the window
+    const auto rebalance = [&] {
+        if (low.size() > high.size() + 1)
+        {
+            high.insert(*low.rbegin());
+            low.erase(std::prev(low.end()));
+        }
+        else if (high.size() > low.size())
+        {
+            low.insert(*high.begin());
+            high.erase(high.begin());
+        }
+    };
+    auto first = begin > left ? begin - left : 0;
+    auto last = first;
+    for (auto i = begin; i < end; ++i)
+    {
+        for (; last < std::min(i + right + 1, size); ++last)
+        {
+            const auto v = static_cast<double>(y[last]);
+            if (!std::isfinite(v))
+                continue;
+            if (low.empty() || v <= *low.rbegin())
+                low.insert(v);
+            else
+                high.insert(v);
+            rebalance();
+        }
+        for (; first + left < i; ++first)
+        {
+            const auto v = static_cast<double>(y[first]);
+            if (!std::isfinite(v))
+                continue;
+            if (v <= *low.rbegin())
+                low.erase(low.find(v));
+            else
+                high.erase(high.find(v));
+            rebalance();
+        }
+        if (low.empty())
+            out[i - begin] = NaN;
+        else
+            out[i - begin] = low.size() > high.size() ? *low.rbegin() : 0.5 * (*low.rbegin() + *high.begin());
+    }
+}
+
+/// Write in @p out the exponentially weighted moving averages of @p y with smoothing factor @p alpha for every i in [@p begin, @p end).
+/// A chunk not starting at zero warms up on the preceding values whose weight exceeds @ref EWMA_HALO_TOLERANCE, which makes it independent of the other chunks.
+/// Non-finite values produce NaN and leave the average unchanged.
+template <typename Y>
+auto ewma(const Y& y, double alpha, std::size_t begin, std::size_t end, double* out) -> void
+{
+    const auto halo = alpha < 1.0 ? static_cast<std::size_t>(std::ceil(std::log(EWMA_HALO_TOLERANCE) / std::log1p(-alpha))) : 0;
+    auto average = NaN;
+    for (auto i = begin > halo ? begin - halo : 0; i < end; ++i)
+    {
+        const auto v = static_cast<double>(y[i]);
+        if (std::isfinite(v))
+            average = std::isfinite(average) ? average + alpha * (v - average) : v;
+        if (i >= begin)
+            out[i - begin] = std::isfinite(v) ? average : NaN;
+    }
+}
+
+} // namespace internal
+
+/// The specification of how a series is smoothed before it is drawn, with a rolling window centered at each value or an exponentially weighted moving average.
+/// Missing (NaN) values are skipped within windows, and smoothing runs on contiguous chunks in parallel, each chunk reading the values around it that its windows overlap.
+class Smoothing
+{
+  public:
+    /// Return the rolling mean over centered windows of @p window values.
+    static auto mean(std::size_t window) -> Smoothing { return Smoothing(Kind::Mean, checkwindow(window)); }
+
+    /// Return the rolling median over centered windows of @p window values, robust to isolated spikes.
+    static auto median(std::size_t window) -> Smoothing { return Smoothing(Kind::Median, checkwindow(window)); }
+
+    /// Return the rolling minimum over centered windows of @p window values.
+    static auto min(std::size_t window) -> Smoothing { return Smoothing(Kind::Min, checkwindow(window)); }
+
+    /// Return the rolling maximum over centered windows of @p window values.
+    static auto max(std::size_t window) -> Smoothing { return Smoothing(Kind::Max, checkwindow(window)); }
+
+    /// Return the exponentially weighted moving average with smoothing factor @p alpha in (0, 1], the weight of each new value.
+    static auto ewma(double alpha) -> Smoothing
+    {
+        if (!(alpha > 0.0 && alpha <= 1.0))
+            throw std::invalid_argument("The smoothing factor of an exponentially weighted moving average must be in (0, 1].");
+        return Smoothing(Kind::EWMA, 1, alpha);
+    }
+
+    /// Return the smoothed values of the first @p size entries of @p y, computed on @p nthreads threads.
+    template <typename Y>
+    auto apply(const Y& y, std::size_t size, std::size_t nthreads) const -> std::vector<double>;
+
+    /// Return the smoothed values of @p y, computed on as many threads as worthwhile.
+    template <typename Y>
+    auto apply(const Y& y) const -> std::vector<double>
+    {
+        const auto size = static_cast<std::size_t>(y.size());
+        const auto grain = m_kind == Kind::Median ? internal::PARALLEL_GRAIN_SIZE / 16 : internal::PARALLEL_GRAIN_SIZE;
+        return apply(y, size, internal::numthreads(size, grain));
+    }
+
+  private:
+    /// The ways in which a series can be smoothed.
+    enum class Kind
+    {
+        Mean,
+        Median,
+        Min,
+        Max,
+        EWMA
+    };
+
+    /// Construct a Smoothing object with given kind, window size and smoothing factor.
+    Smoothing(Kind kind, std::size_t window, double alpha = NaN)
+        : m_kind(kind), m_window(window), m_alpha(alpha) {}
+
+    /// Return the given window size after checking it is positive.
+    static auto checkwindow(std::size_t window) -> std::size_t
+    {
+        if (window == 0)
+            throw std::invalid_argument("The window of a rolling smoothing must contain at least one value.");
+        return window;
+    }
+
+    /// The way in which the series is smoothed.
+    Kind m_kind;
+
+    /// The number of values in each rolling window.
+    std::size_t m_window;
+
+    /// The smoothing factor of the exponentially weighted moving average.
+    double m_alpha;
+};
+
+template <typename Y>
+auto Smoothing::apply(const Y& y, std::size_t size, std::size_t nthreads) const -> std::vector<double>
+{
+    std::vector<double> result(size);
+    const auto left = (m_window - 1) / 2;
+    const auto right = m_window / 2;
+    internal::parallelfor(size, nthreads, [&](std::size_t begin, std::size_t end, std::size_t) {
+        auto out = result.data() + begin;
+        switch (m_kind)
+        {
+        case Kind::Mean:
+            internal::rollingmean(y, size, left, right, begin, end, out);
+            break;
+        case Kind::Median:
+            internal::rollingmedian(y, size, left, right, begin, end, out);
+            break;
+        case Kind::Min:
+            internal::rollingextreme(y, size, left, right, begin, end, false, out);
+            break;
+        case Kind::Max:
+            internal::rollingextreme(y, size, left, right, begin, end, true, out);
+            break;
+        case Kind::EWMA:
+            internal::ewma(y, m_alpha, begin, end, out);
+            break;
+        }
+    });
+    return result;
+}
+
+} // namespace sciplot
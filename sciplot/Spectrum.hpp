@@ -0,0 +1,134 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/FFT.hpp>
+#include <sciplot/Parallel.hpp>
+#include <sciplot/Utils.hpp>
+
+namespace sciplot
+{
+namespace internal
+{
+
+/// Return the periodic Hann window of @p size points, which tapers frames to zero at both ends to reduce spectral leakage.
+inline auto hannwindow(std::size_t size) -> std::vector<double>
+{
+    std::vector<double> window(size);
+    for (std::size_t i = 0; i < size; ++i)
+        window[i] = 0.5 - 0.5 * std::cos(2.0 * PI * i / size);
+    return window;
+}
+
+/// The one-sided power spectral densities of the frames of a signal.
+struct FrameSpectra
+{
+    /// The number of frames.
+    std::size_t numframes = 0;
+
+    /// The frequencies of the spectra, from zero to the Nyquist frequency.
+    std::vector<double> frequencies;
+
+    /// The power spectral densities, one row per frequency with one value per frame.
+    std::vector<double> power;
+};
+
+/// Return the one-sided power spectral densities (in units² per Hz) of the frames of @p window samples, starting every @p hop samples, of the first @p size entries of @p signal sampled at @p fs.
+/// Every frame is tapered by a Hann window and zero padded to a power of two before its FFT. Frames are transformed in parallel; missing (NaN) samples count as zero.
+template <typename S>
+auto framespectra(const S& signal, std::size_t size, double fs, std::size_t window, std::size_t hop) -> FrameSpectra
+{
+    if (!(fs > 0.0))
+        throw std::invalid_argument("The sampling frequency of a signal must be positive.");
+    if (window < 2 || hop < 1)
+        throw std::invalid_argument("The frames of a spectrum must span at least two samples and be at least one sample apart.");
+    const auto taper = hannwindow(window);
+    auto taperpower = 0.0;
+    for (auto w : taper)
+        taperpower += w * w;
+    const auto nfft = nextpow2(window);
+    const auto numbins = nfft / 2 + 1;
+
+    FrameSpectra spectra;
+    spectra.numframes = size >= window ? 1 + (size - window) / hop : 0;
+    spectra.frequencies.resize(numbins);
+    for (std::size_t k = 0; k < numbins; ++k)
+        spectra.frequencies[k] = k * fs / nfft;
+    spectra.power.resize(numbins * spectra.numframes);
+
+    const auto numframes = spectra.numframes;
+    parallelfor(numframes, numthreads(numframes * window), [&](std::size_t begin, std::size_t end, std::size_t) {
+        std::vector<std::complex<double>> data(nfft);
+        for (auto f = begin; f < end; ++f)
+        {
+            std::fill(data.begin(), data.end(), 0.0);
+            for (std::size_t i = 0; i < window; ++i)
+            {
+                const auto v = static_cast<double>(signal[f * hop + i]);
+                data[i] = std::isfinite(v) ? v * taper[i] : 0.0;
+            }
+            fft(data);
+            for (std::size_t k = 0; k < numbins; ++k)
+            {
+                // Fold the power of the negative frequencies onto the positive ones, except at zero and the Nyquist frequency
+                const auto factor = k == 0 || 2 * k == nfft ? 1.0 : 2.0;
+                spectra.power[k * numframes + f] = factor * std::norm(data[k]) / (fs * taperpower);
+            }
+        }
+    });
+    return spectra;
+}
+
+/// Return the frequencies and the one-sided power spectral density of the first @p size entries of @p signal sampled at @p fs.
+/// If @p segment is zero, the density is the periodogram of the whole signal; otherwise it is Welch's estimate, the average over segments of @p segment samples overlapping by half.
+template <typename S>
+auto powerspectrum(const S& signal, std::size_t size, double fs, std::size_t segment) -> std::pair<std::vector<double>, std::vector<double>>
+{
+    if (size < 2)
+        return {};
+    const auto window = segment ? std::min(segment, size) : size;
+    auto spectra = framespectra(signal, size, fs, window, std::max<std::size_t>(window / 2, 1));
+    std::vector<double> psd(spectra.frequencies.size(), 0.0);
+    for (std::size_t k = 0; k < psd.size(); ++k)
+    {
+        for (std::size_t f = 0; f < spectra.numframes; ++f)
+            psd[k] += spectra.power[k * spectra.numframes + f];
+        psd[k] /= spectra.numframes;
+    }
+    return {std::move(spectra.frequencies), std::move(psd)};
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -30,11 +30,14 @@
 #include <cctype>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <string>
 #include <type_traits>
 #include <valarray>
+#include <vector>
 
 // sciplot includes
 #include <sciplot/Constants.hpp>
@@ -55,6 +58,14 @@ auto str(const T& val) -> std::string
     return ss.str(); // Note: This is different than std::to_string(i). For example, it works with custom types. Also, std::to_string(2.0) may produce "2.000000", difficulting string comparison in the tests.
 }
 
+/// Return a string for a given number with as many digits as needed to recover it exactly (e.g., for coordinates passed to gnuplot in a command)
+inline auto strexact(double val) -> std::string
+{
+    std::stringstream ss;
+    ss << std::setprecision(17) << val;
+    return ss.str();
+}
+
 /// Return a string for a given char array
 inline auto str(const char* word) -> std::string
 {
@@ -123,6 +134,15 @@ auto minsize(const VectorType& v, const Args&... args) -> std::size_t
     return std::min<decltype(v.size())>(v.size(), minsize(args...));
 }
 
+/// Return the @p size coordinates equally spaced over [@p first, @p last] (the nodes of a uniform grid along one axis).
+inline auto gridpoints(double first, double last, std::size_t size) -> std::vector<double>
+{
+    std::vector<double> values(size);
+    for (std::size_t i = 0; i < size; ++i)
+        values[i] = size > 1 ? first + (last - first) * i / (size - 1) : first;
+    return values;
+}
+
 /// Check if type @p T is `std::string`.
 template <typename T>
 constexpr auto isString = std::is_same_v<std::decay_t<T>, std::string>;
@@ -253,6 +273,109 @@ auto writedataset(std::ostream& out, std::size_t index, const Args&... args) ->
     return out;
 }
 
+/// Auxiliary function to create a data set with the given @p columns, whose number is only known at run time
+inline auto writecolumns(std::ostream& out, std::size_t index, const std::vector<std::vector<double>>& columns) -> std::ostream&
+{
+    out << "#==============================================================================" << std::endl;
+    out << "# DATASET #" << index << std::endl;
+    out << "#==============================================================================" << std::endl;
+    auto size = columns.empty() ? 0 : columns.front().size();
+    for (const auto& column : columns)
+        size = std::min(size, column.size());
+    for (std::size_t i = 0; i < size; ++i)
+        for (std::size_t j = 0; j < columns.size(); ++j)
+            out << internal::escapeIfNeeded(columns[j][i]) << (j + 1 < columns.size() ? ' ' : '\n');
+    out << "\n\n";
+    return out;
+}
+
+/// Auxiliary function to create a data set made of blocks separated by blank lines (e.g., one polygon per block), where block `k` ends before row `blockends[k]`
+template <typename... Args>
+auto writeblockdataset(std::ostream& out, std::size_t index, const std::vector<std::size_t>& blockends, const Args&... args) -> std::ostream&
+{
+    out << "#==============================================================================" << std::endl;
+    out << "# DATASET #" << index << std::endl;
+    out << "#==============================================================================" << std::endl;
+    const auto size = internal::minsize(args...);
+    std::size_t begin = 0;
+    for (auto end : blockends)
+    {
+        end = std::min(end, size);
+        for (auto i = begin; i < end; ++i)
+            internal::writeline(out, i, args...);
+        // A single blank line ends a block without ending the data set
+        out << '\n';
+        begin = end;
+    }
+    // A second blank line after the last block ends the data set, which needs both blank lines if it has no blocks, as otherwise it merges with the next data set
+    out << (blockends.empty() ? "\n\n" : "\n");
+    return out;
+}
+
+/// Auxiliary function to append the first @p size entries of @p values to @p out as native 32-bit floats, the format gnuplot expects in binary data files
+template <typename Values>
+auto writefloats(std::string& out, const Values& values, std::size_t size) -> std::string&
+{
+    const auto offset = out.size();
+    out.resize(offset + size * sizeof(float));
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto value = static_cast<float>(values[i]);
+        std::memcpy(&out[offset + i * sizeof(float)], &value, sizeof(float));
+    }
+    return out;
+}
+
+/// Auxiliary function to create a matrix in gnuplot's binary matrix format, with `valueat(j, i)` the value at the @p y coordinate of index j and the @p x coordinate of index i
+/// @note The first row holds the number of columns followed by the x coordinates, and every other row a y coordinate followed by the values of that row.
+template <typename X, typename Y, typename ValueFn>
+auto binarymatrixof(const X& x, const Y& y, const ValueFn& valueat) -> std::string
+{
+    const auto nx = internal::minsize(x);
+    const auto ny = internal::minsize(y);
+    std::string out;
+    out.reserve((nx + 1) * (ny + 1) * sizeof(float));
+    const double header[] = {static_cast<double>(nx)};
+    writefloats(out, header, 1);
+    writefloats(out, x, nx);
+    std::vector<double> row(nx);
+    for (std::size_t j = 0; j < ny; ++j)
+    {
+        const double yj[] = {static_cast<double>(y[j])};
+        writefloats(out, yj, 1);
+        for (std::size_t i = 0; i < nx; ++i)
+            row[i] = static_cast<double>(valueat(j, i));
+        writefloats(out, row, nx);
+    }
+    return out;
+}
+
+/// Auxiliary function to create a matrix in gnuplot's binary matrix format, with values @p z given row by row (one row per @p y coordinate, one column per @p x coordinate)
+template <typename X, typename Y>
+auto binarymatrix(const X& x, const Y& y, const std::vector<double>& z) -> std::string
+{
+    const auto nx = internal::minsize(x);
+    return binarymatrixof(x, y, [&](std::size_t j, std::size_t i) { return z[j * nx + i]; });
+}
+
+/// Auxiliary function to create an array of @p height rows and @p width columns in gnuplot's binary array format, with `valueat(j, i, c)` the value of channel c at row j and column i
+/// @note The array is written row after row, with the @p numchannels values of every entry consecutive, all as 32-bit floats (i.e., `format='%float32'` repeated once per channel).
+template <typename ValueFn>
+auto binaryarrayof(std::size_t width, std::size_t height, std::size_t numchannels, const ValueFn& valueat) -> std::string
+{
+    std::string out;
+    out.reserve(width * height * numchannels * sizeof(float));
+    std::vector<double> row(width * numchannels);
+    for (std::size_t j = 0; j < height; ++j)
+    {
+        for (std::size_t i = 0; i < width; ++i)
+            for (std::size_t c = 0; c < numchannels; ++c)
+                row[i * numchannels + c] = static_cast<double>(valueat(j, i, c));
+        writefloats(out, row, row.size());
+    }
+    return out;
+}
+
 /// Auxiliary function to write palette data for a selected palette to start of plot script
 inline auto palettecmd(std::ostream& out, std::string palette) -> std::ostream&
 {
@@ -0,0 +1,90 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace sciplot
+{
+
+/// The class used to pass a three-dimensional array of values stored with arbitrary strides (e.g., a sub-volume of a larger array) without copying it.
+/// The entry at layer k, row j, and column i is the value at the k-th *z*, the j-th *y*, and the i-th *x* coordinate of a grid.
+class VolumeView
+{
+  public:
+    /// Construct a VolumeView object for the contiguous array of @p layers layers of @p rows rows and @p cols columns, stored layer after layer and row after row at @p data.
+    VolumeView(const double* data, std::size_t layers, std::size_t rows, std::size_t cols)
+        : VolumeView(data, layers, rows, cols, static_cast<std::ptrdiff_t>(rows * cols), static_cast<std::ptrdiff_t>(cols), 1) {}
+
+    /// Construct a VolumeView object for the array of @p layers layers of @p rows rows and @p cols columns whose entry (k, j, i) is at `data[k * layerstride + j * rowstride + i * colstride]`.
+    VolumeView(const double* data, std::size_t layers, std::size_t rows, std::size_t cols, std::ptrdiff_t layerstride, std::ptrdiff_t rowstride, std::ptrdiff_t colstride)
+        : m_data(data), m_layers(layers), m_rows(rows), m_cols(cols), m_layerstride(layerstride), m_rowstride(rowstride), m_colstride(colstride) {}
+
+    /// Construct a VolumeView object for the contiguous array of @p layers layers of @p rows rows stored layer after layer and row after row in @p values.
+    VolumeView(const std::vector<double>& values, std::size_t layers, std::size_t rows)
+        : VolumeView(values.data(), layers, rows, layers && rows ? values.size() / (layers * rows) : 0) {}
+
+    /// Return the entry at layer @p k, row @p j, and column @p i.
+    auto operator()(std::size_t k, std::size_t j, std::size_t i) const -> double
+    {
+        return m_data[static_cast<std::ptrdiff_t>(k) * m_layerstride + static_cast<std::ptrdiff_t>(j) * m_rowstride + static_cast<std::ptrdiff_t>(i) * m_colstride];
+    }
+
+    /// Return the number of layers.
+    auto layers() const -> std::size_t { return m_layers; }
+
+    /// Return the number of rows.
+    auto rows() const -> std::size_t { return m_rows; }
+
+    /// Return the number of columns.
+    auto cols() const -> std::size_t { return m_cols; }
+
+  private:
+    /// The address of the entry at layer 0, row 0, and column 0.
+    const double* m_data;
+
+    /// The number of layers.
+    std::size_t m_layers;
+
+    /// The number of rows.
+    std::size_t m_rows;
+
+    /// The number of columns.
+    std::size_t m_cols;
+
+    /// The distance between consecutive layers, in entries.
+    std::ptrdiff_t m_layerstride;
+
+    /// The distance between consecutive rows, in entries.
+    std::ptrdiff_t m_rowstride;
+
+    /// The distance between consecutive columns, in entries.
+    std::ptrdiff_t m_colstride;
+};
+
+} // namespace sciplot
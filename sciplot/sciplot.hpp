@@ -37,13 +37,32 @@
 // sciplot includes
 #include <sciplot/Canvas.hpp>
 #include <sciplot/Constants.hpp>
+#include <sciplot/Contour.hpp>
+#include <sciplot/Correlation.hpp>
+#include <sciplot/Decimation.hpp>
 #include <sciplot/Default.hpp>
+#include <sciplot/Density.hpp>
 #include <sciplot/Enums.hpp>
+#include <sciplot/FFT.hpp>
+#include <sciplot/Fit.hpp>
 #include <sciplot/Figure.hpp>
+#include <sciplot/Hexbin.hpp>
+#include <sciplot/Histogram.hpp>
+#include <sciplot/Isosurface.hpp>
+#include <sciplot/LevelOfDetail.hpp>
+#include <sciplot/MatrixView.hpp>
+#include <sciplot/MeshDecimation.hpp>
 #include <sciplot/Palettes.hpp>
+#include <sciplot/Parallel.hpp>
 #include <sciplot/Plot.hpp>
 #include <sciplot/Plot2D.hpp>
 #include <sciplot/Plot3D.hpp>
+#include <sciplot/Quantiles.hpp>
+#include <sciplot/RenderStats.hpp>
+#include <sciplot/Sampling.hpp>
+#include <sciplot/Smoothing.hpp>
+#include <sciplot/Spectrum.hpp>
 #include <sciplot/StringOrDouble.hpp>
 #include <sciplot/Utils.hpp>
 #include <sciplot/Vec.hpp>
+#include <sciplot/VolumeView.hpp>
@@ -0,0 +1,111 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Constants.hpp>
+#include <sciplot/Contour.hpp>
+using namespace sciplot;
+
+TEST_CASE("Contour", "[contour]")
+{
+    // A grid over [-1, 1] x [-1, 1] with more rows of cells than a tile, so that segments of several tiles are stitched together
+    const std::size_t n = 201;
+    std::vector<double> grid(n);
+    for (std::size_t i = 0; i < n; ++i)
+        grid[i] = -1.0 + 2.0 * i / (n - 1);
+
+    SECTION("closed isolines")
+    {
+        const auto valueat = [&](std::size_t j, std::size_t i) { return grid[i] * grid[i] + grid[j] * grid[j]; };
+        const auto lines = internal::isolines(grid, grid, n, n, valueat, {0.25, 0.81});
+        REQUIRE(lines.size() == 2);
+        for (std::size_t l = 0; l < 2; ++l)
+        {
+            const auto radius = l == 0 ? 0.5 : 0.9;
+            REQUIRE(lines[l].blockends.size() == 1);
+            REQUIRE(lines[l].x.size() == lines[l].blockends.front());
+            CHECK(lines[l].x.front() == lines[l].x.back());
+            CHECK(lines[l].y.front() == lines[l].y.back());
+            for (std::size_t k = 0; k < lines[l].x.size(); ++k)
+                CHECK(std::hypot(lines[l].x[k], lines[l].y[k]) == Approx(radius).margin(1e-3));
+        }
+    }
+
+    SECTION("open isolines broken at missing values")
+    {
+        // A plane rising along x crosses the level between columns 130 and 131 at every row, and a missing node in column 130 removes the two cells around it
+        const auto valueat = [&](std::size_t j, std::size_t i) { return i == 130 && j == 100 ? NaN : grid[i]; };
+        const auto lines = internal::isolines(grid, grid, n, n, valueat, {0.305});
+        REQUIRE(lines.size() == 1);
+        REQUIRE(lines[0].blockends.size() == 2);
+        CHECK(lines[0].blockends[0] == 100);
+        CHECK(lines[0].blockends[1] == 200);
+        for (std::size_t k = 0; k < lines[0].x.size(); ++k)
+            CHECK(lines[0].x[k] == Approx(0.305));
+    }
+
+    SECTION("saddles")
+    {
+        // The corners on one diagonal are high and on the other low, so every level between them crosses all four edges of the cell
+        const std::vector<double> x = {0.0, 1.0};
+        const std::vector<double> z = {1.0, 0.0, 0.0, 1.0};
+        const auto valueat = [&](std::size_t j, std::size_t i) { return z[j * 2 + i]; };
+        const auto lines = internal::isolines(x, x, 2, 2, valueat, {0.25, 0.75});
+        // Below the mean of the corners the high corners are joined through the center, so the isolines cut off the low corners, and above it the high corners
+        const double corners[2][2][2] = {{{1.0, 0.0}, {0.0, 1.0}}, {{0.0, 0.0}, {1.0, 1.0}}};
+        for (std::size_t l = 0; l < 2; ++l)
+        {
+            REQUIRE(lines[l].blockends.size() == 2);
+            CHECK(lines[l].blockends[0] == 2);
+            CHECK(lines[l].blockends[1] == 4);
+            for (std::size_t b = 0; b < 2; ++b)
+            {
+                auto cutoff = false;
+                for (const auto& corner : corners[l])
+                {
+                    const auto d0 = std::abs(lines[l].x[2 * b] - corner[0]) + std::abs(lines[l].y[2 * b] - corner[1]);
+                    const auto d1 = std::abs(lines[l].x[2 * b + 1] - corner[0]) + std::abs(lines[l].y[2 * b + 1] - corner[1]);
+                    cutoff = cutoff || (d0 == Approx(0.25) && d1 == Approx(0.25));
+                }
+                CHECK(cutoff);
+            }
+        }
+    }
+
+    SECTION("empty grids and constant fields")
+    {
+        const auto valueat = [](std::size_t, std::size_t) { return 1.0; };
+        CHECK(internal::isolines(grid, grid, n, n, valueat, {1.5})[0].x.empty());
+        CHECK(internal::isolines(grid, grid, 1, n, valueat, {0.5})[0].x.empty());
+    }
+}
@@ -0,0 +1,112 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Correlation.hpp>
+using namespace sciplot;
+
+TEST_CASE("Correlation", "[correlation]")
+{
+    SECTION("dot product")
+    {
+        const std::vector<double> a = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+        CHECK(internal::dot(a.data(), a.data(), a.size()) == 140.0);
+    }
+
+    SECTION("blocked matrix matches the direct computation")
+    {
+        // More series than a tile and more samples than a block, so that several tiles and blocks are combined
+        const std::size_t n = 70;
+        const std::size_t size = 2500;
+        std::vector<std::vector<double>> columns(n, std::vector<double>(size + n));
+        for (std::size_t c = 0; c < n; ++c)
+            for (std::size_t i = 0; i < columns[c].size(); ++i)
+                columns[c][i] = std::sin(0.001 * (c + 1) * i + c) + 0.01 * ((i * (c + 7)) % 13);
+        columns[5] = std::vector<double>(size, 2.0); // constant, and the shortest series
+
+        const auto correlations = internal::correlationmatrix(columns);
+        REQUIRE(correlations.size() == n * n);
+
+        const auto direct = [&](std::size_t a, std::size_t b) {
+            double ma = 0.0, mb = 0.0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ma += columns[a][i] / size;
+                mb += columns[b][i] / size;
+            }
+            double sab = 0.0, saa = 0.0, sbb = 0.0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                sab += (columns[a][i] - ma) * (columns[b][i] - mb);
+                saa += (columns[a][i] - ma) * (columns[a][i] - ma);
+                sbb += (columns[b][i] - mb) * (columns[b][i] - mb);
+            }
+            return sab / std::sqrt(saa * sbb);
+        };
+        for (std::size_t a = 0; a < n; a += 3)
+        {
+            for (std::size_t b = 0; b < n; b += 7)
+            {
+                if (a == 5 || b == 5)
+                    CHECK(std::isnan(correlations[a * n + b]));
+                else
+                    CHECK(correlations[a * n + b] == Approx(direct(a, b)).margin(1e-12));
+            }
+        }
+        CHECK(correlations[1 * n + 1] == Approx(1.0));
+        CHECK(correlations[1 * n + 40] == correlations[40 * n + 1]);
+    }
+
+    SECTION("missing values are replaced by the mean of their series")
+    {
+        const std::vector<std::vector<double>> columns = {{1.0, 2.0, NaN, 4.0}, {2.0, 4.0, 5.0, 8.0}};
+        const auto correlations = internal::correlationmatrix(columns);
+        // The first series becomes {1, 2, 7/3, 4}
+        const std::vector<double> x = {1.0, 2.0, 7.0 / 3.0, 4.0};
+        const std::vector<double> y = {2.0, 4.0, 5.0, 8.0};
+        double mx = 0.0, my = 0.0;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            mx += x[i] / 4;
+            my += y[i] / 4;
+        }
+        double sxy = 0.0, sxx = 0.0, syy = 0.0;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            sxy += (x[i] - mx) * (y[i] - my);
+            sxx += (x[i] - mx) * (x[i] - mx);
+            syy += (y[i] - my) * (y[i] - my);
+        }
+        CHECK(correlations[1] == Approx(sxy / std::sqrt(sxx * syy)));
+    }
+}
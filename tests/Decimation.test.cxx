@@ -0,0 +1,189 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Decimation.hpp>
+using namespace sciplot;
+
+TEST_CASE("Decimation", "[decimation]")
+{
+    SECTION("envelope")
+    {
+        const std::vector<double> x = {0.0, 0.1, 0.2, 0.9, 1.0};
+        const std::vector<double> y = {1.0, 2.0, 3.0, 4.0, 6.0};
+        const std::vector<double> ylow = {0.5, 1.0, 2.5, 3.0, 5.0};
+        const std::vector<double> yhigh = {1.5, 4.0, 3.5, 5.0, 7.0};
+
+        const auto env = internal::envelope(x, y, ylow, yhigh, 2);
+
+        REQUIRE(env.x.size() == 2);
+        CHECK(env.x[0] == Approx(0.1));
+        CHECK(env.y[0] == Approx(2.0));
+        CHECK(env.low[0] == 0.5);
+        CHECK(env.high[0] == 4.0);
+        CHECK(env.x[1] == Approx(0.95));
+        CHECK(env.y[1] == Approx(5.0));
+        CHECK(env.low[1] == 3.0);
+        CHECK(env.high[1] == 7.0);
+    }
+
+    SECTION("envelope with delta and missing values")
+    {
+        const std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+        const std::vector<double> y = {1.0, NaN, 3.0, 5.0};
+        const std::vector<double> ydelta = {0.5, 0.5, 1.0, 0.5};
+
+        const auto env = internal::envelopedelta(x, y, ydelta, 100);
+
+        REQUIRE(env.x.size() == 3);
+        CHECK(env.x[1] == 2.0);
+        CHECK(env.low[1] == 2.0);
+        CHECK(env.high[1] == 4.0);
+    }
+
+    SECTION("m4indices")
+    {
+        std::vector<double> x(100);
+        std::vector<double> y(100);
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            x[i] = static_cast<double>(i);
+            y[i] = static_cast<double>(i % 7);
+        }
+        y[42] = -5.0;
+        y[57] = 20.0;
+
+        const auto indices = internal::m4indices(x, y, x.size(), 2, 100);
+
+        CHECK(indices == std::vector<std::size_t>{0, 6, 42, 49, 50, 56, 57, 99});
+    }
+
+    SECTION("m4indices with unsorted x")
+    {
+        const std::vector<double> x = {0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0};
+        const std::vector<double> y = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0};
+
+        const auto indices = internal::m4indices(x, y, x.size(), 2, 4);
+
+        CHECK(indices == std::vector<std::size_t>{0, 11});
+    }
+
+    SECTION("runindices")
+    {
+        const std::vector<double> y = {1.0, 1.0, 1.0, 2.0, 2.0, 2.0, 3.0, NaN, NaN, 3.0, 3.0, 3.0};
+
+        CHECK(internal::runindices(y, y.size()) == std::vector<std::size_t>{0, 1, 2, 3, 5, 6, 7, 8, 9, 10, 11});
+
+        // The rows next to the ends are kept within runs, since they set the width of the first and last steps drawn with histeps
+        const std::vector<double> runs = {1.0, 1.0, 1.0, 1.0, 2.0, 2.0, 2.0, 2.0};
+        CHECK(internal::runindices(runs, runs.size()) == std::vector<std::size_t>{0, 1, 3, 4, 6, 7});
+    }
+
+    SECTION("stepindices")
+    {
+        std::vector<double> x(1000);
+        std::vector<double> y(1000);
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            x[i] = static_cast<double>(i);
+            y[i] = i < 500 ? 0.0 : 1.0;
+        }
+        y[700] = 5.0; // a short spike must survive the reduction
+
+        CHECK(internal::stepindices(x, y, x.size(), 0, 0) == std::vector<std::size_t>{0, 1, 499, 500, 699, 700, 701, 998, 999});
+        CHECK(internal::stepindices(x, y, x.size(), 2, 6) == std::vector<std::size_t>{0, 499, 500, 700, 999});
+    }
+
+    SECTION("monotoneindices")
+    {
+        std::vector<double> x(1000);
+        std::vector<double> y(1000);
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            x[i] = static_cast<double>(i + 1);
+            y[i] = (i + 1) / 1000.0;
+        }
+
+        const auto indices = internal::monotoneindices(x, y, x.size(), 10, 10, false, false);
+
+        CHECK(indices.size() <= 21);
+        CHECK(indices.front() == 0);
+        CHECK(indices.back() == 999);
+        CHECK(std::is_sorted(indices.begin(), indices.end()));
+
+        // In log space the first decade gets as many pixels as the last one
+        const auto logindices = internal::monotoneindices(x, y, x.size(), 9, 9, true, true);
+        CHECK(logindices.size() <= 19);
+        CHECK(std::count_if(logindices.begin(), logindices.end(), [](std::size_t i) { return i < 10; }) >= 3);
+    }
+
+    SECTION("meanpool")
+    {
+        // A 3 x 4 matrix (rows of 4 values) reduced to 2 x 2, with blocks of rows {0} and {1, 2}
+        const std::vector<double> z = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, NaN, 11.0, 12.0};
+        const auto pooled = internal::meanpool(z, 4, 3, 2, 2);
+        REQUIRE(pooled.size() == 4);
+        CHECK(pooled[0] == Approx(1.5));
+        CHECK(pooled[1] == Approx(3.5));
+        CHECK(pooled[2] == Approx((5.0 + 6.0 + 9.0) / 3.0));
+        CHECK(pooled[3] == Approx((7.0 + 8.0 + 11.0 + 12.0) / 4.0));
+        const auto unchanged = internal::meanpool(z, 4, 3, 10, 10);
+        REQUIRE(unchanged.size() == z.size());
+        CHECK(unchanged[11] == 12.0);
+    }
+
+    SECTION("fitwithin")
+    {
+        CHECK(internal::fitwithin(300, 200, 0, true) == std::make_pair<std::size_t, std::size_t>(300, 200));
+        CHECK(internal::fitwithin(300, 200, 60000, true) == std::make_pair<std::size_t, std::size_t>(300, 200));
+        CHECK(internal::fitwithin(300, 200, 6000, true) == std::make_pair<std::size_t, std::size_t>(94, 63));
+        CHECK(internal::fitwithin(300, 200, 100, false) == std::make_pair<std::size_t, std::size_t>(60, 40));
+        CHECK(internal::fitwithin(300, 200, 1, true) == std::make_pair<std::size_t, std::size_t>(1, 1));
+    }
+
+    SECTION("pool")
+    {
+        // The same reduction taking the maximum of every block, read through an accessor to the transpose of the matrix
+        const std::vector<double> zt = {1.0, 5.0, 9.0, 2.0, 6.0, NaN, 3.0, 7.0, 11.0, 4.0, 8.0, 12.0};
+        const auto valueat = [&](std::size_t j, std::size_t i) { return zt[i * 3 + j]; };
+        const auto pooled = internal::pool(valueat, 4, 3, 2, 2, Pooling::max);
+        REQUIRE(pooled.size() == 4);
+        CHECK(pooled[0] == 2.0);
+        CHECK(pooled[1] == 4.0);
+        CHECK(pooled[2] == 9.0);
+        CHECK(pooled[3] == 12.0);
+        const auto kept = internal::pool(valueat, 4, 3, 2, 2, Pooling::none);
+        REQUIRE(kept.size() == 12);
+        CHECK(kept[4] == 5.0);
+        CHECK(kept[8] == 9.0);
+    }
+}
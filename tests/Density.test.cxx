@@ -0,0 +1,95 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Density.hpp>
+using namespace sciplot;
+
+TEST_CASE("Density", "[density]")
+{
+    const std::vector<double> samples = {-1.0, 0.0, 0.0, 1.0, 2.5, NaN};
+
+    SECTION("moments of the finite samples")
+    {
+        const auto [count, mean, stddev] = internal::samplemoments(samples, samples.size());
+        CHECK(count == 5);
+        CHECK(mean == Approx(0.5));
+        CHECK(stddev == Approx(std::sqrt(7.0 / 4.0)));
+    }
+
+    SECTION("bandwidth rules")
+    {
+        const auto stddev = std::sqrt(7.0 / 4.0);
+        CHECK(Bandwidth::scott().select(samples, samples.size(), 5, stddev) == Approx(1.06 * stddev * std::pow(5.0, -0.2)));
+        CHECK(Bandwidth::silverman().select(samples, samples.size(), 5, stddev) == Approx(0.9 * (1.0 / 1.34) * std::pow(5.0, -0.2)));
+        CHECK(Bandwidth::value(0.25).select(samples, samples.size(), 5, stddev) == 0.25);
+        CHECK_THROWS(Bandwidth::value(0.0));
+    }
+
+    SECTION("binned FFT estimate agrees with the direct sum over the samples")
+    {
+        const auto h = 0.5;
+        const auto [x, density] = internal::kde(samples, samples.size(), Bandwidth::value(h), 256);
+        REQUIRE(x.size() == 256);
+        CHECK(x.front() == Approx(-1.0 - 3.0 * h));
+        CHECK(x.back() == Approx(2.5 + 3.0 * h));
+        auto integral = 0.0;
+        for (std::size_t k = 0; k < x.size(); ++k)
+        {
+            auto expected = 0.0;
+            for (auto s : {-1.0, 0.0, 0.0, 1.0, 2.5})
+                expected += std::exp(-0.5 * (x[k] - s) * (x[k] - s) / (h * h)) / (h * std::sqrt(2.0 * PI) * 5.0);
+            CHECK(density[k] == Approx(expected).margin(1e-3));
+            integral += density[k] * (x[1] - x[0]);
+        }
+        CHECK(integral == Approx(1.0).epsilon(0.01));
+    }
+
+    SECTION("no finite samples")
+    {
+        const auto [x, density] = internal::kde(std::vector<double>{NaN}, 1, Bandwidth::scott(), 16);
+        CHECK(x.empty());
+        CHECK(density.empty());
+    }
+
+    SECTION("estimates of several groups match those of each group")
+    {
+        const std::vector<std::vector<double>> groups = {samples, {}, {3.0, 4.0, 4.5}};
+        const auto densities = internal::kdes(groups, Bandwidth::value(0.5), 64);
+        REQUIRE(densities.size() == 3);
+        const auto [x, density] = internal::kde(samples, samples.size(), Bandwidth::value(0.5), 64);
+        CHECK(densities[0].first == x);
+        CHECK(densities[0].second == density);
+        CHECK(densities[1].first.empty());
+        CHECK(densities[2].first.size() == 64);
+    }
+}
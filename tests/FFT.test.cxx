@@ -0,0 +1,68 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <complex>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/FFT.hpp>
+using namespace sciplot;
+
+TEST_CASE("FFT", "[fft]")
+{
+    CHECK(internal::nextpow2(1) == 1);
+    CHECK(internal::nextpow2(5) == 8);
+    CHECK(internal::nextpow2(8) == 8);
+
+    SECTION("transform agrees with the direct DFT and is inverted")
+    {
+        const std::size_t n = 16;
+        std::vector<std::complex<double>> data(n);
+        for (std::size_t i = 0; i < n; ++i)
+            data[i] = {std::sin(0.3 * i) + 0.1 * i, std::cos(1.7 * i)};
+        auto transformed = data;
+        internal::fft(transformed);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::complex<double> expected = 0.0;
+            for (std::size_t i = 0; i < n; ++i)
+                expected += data[i] * std::polar(1.0, -2.0 * PI * k * i / n);
+            CHECK(std::abs(transformed[k] - expected) < 1e-9);
+        }
+        internal::fft(transformed, true);
+        for (std::size_t i = 0; i < n; ++i)
+            CHECK(std::abs(transformed[i] - data[i]) < 1e-9);
+    }
+
+    SECTION("sizes other than powers of two are rejected")
+    {
+        std::vector<std::complex<double>> data(6);
+        CHECK_THROWS(internal::fft(data));
+    }
+}
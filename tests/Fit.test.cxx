@@ -0,0 +1,152 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Fit.hpp>
+using namespace sciplot;
+
+TEST_CASE("Fit", "[fit]")
+{
+    SECTION("least squares merged across chunks match a single pass")
+    {
+        internal::LeastSquares all(3), first(3), second(3);
+        for (auto i = 0; i < 20; ++i)
+        {
+            const double t = 0.1 * i - 1.0;
+            const double b = 1.0 + 2.0 * t - 0.5 * t * t + (i % 3 == 0 ? 0.1 : -0.05);
+            double row[3], copy[3];
+            internal::chebyshev(t, 3, row);
+            std::copy(row, row + 3, copy);
+            all.addrow(row, b);
+            (i < 7 ? first : second).addrow(copy, b);
+        }
+        first.merge(second);
+        CHECK(first.count == 20);
+        CHECK(first.rss == Approx(all.rss));
+        const auto expected = all.solve();
+        const auto merged = first.solve();
+        for (std::size_t k = 0; k < 3; ++k)
+            CHECK(merged[k] == Approx(expected[k]));
+    }
+
+    SECTION("chebyshev coefficients converted to powers of x")
+    {
+        // 1 T0 + 2 T1 + 3 T2 = 1 + 2t + 3(2t² - 1) = -2 + 2t + 6t², with t = (x - 1) / 2
+        const auto coeffs = internal::chebyshevtomonomial({1.0, 2.0, 3.0}, 1.0, 2.0);
+        REQUIRE(coeffs.size() == 3);
+        CHECK(coeffs[0] == Approx(-2.0 - 1.0 + 1.5));
+        CHECK(coeffs[1] == Approx(1.0 - 3.0));
+        CHECK(coeffs[2] == Approx(1.5));
+    }
+
+    SECTION("polynomial fit recovers exact coefficients at large offsets")
+    {
+        std::vector<double> x, y;
+        for (auto i = 0; i < 1000; ++i)
+        {
+            x.push_back(1.0e4 + 0.01 * i);
+            y.push_back(3.0 - 0.5 * x.back() + 2.0e-4 * x.back() * x.back());
+        }
+        x.push_back(NaN);
+        y.push_back(1.0);
+        const Fit fit(x, y, FitModel::polynomial(2));
+        CHECK(fit.count() == 1000);
+        CHECK(fit(1.0e4 + 5.0) == Approx(3.0 - 0.5 * (1.0e4 + 5.0) + 2.0e-4 * (1.0e4 + 5.0) * (1.0e4 + 5.0)));
+        const auto coeffs = fit.coefficients();
+        REQUIRE(coeffs.size() == 3);
+        CHECK(coeffs[2] == Approx(2.0e-4).epsilon(1e-6));
+        CHECK(fit.residualStdDev() == Approx(0.0).margin(1e-6));
+    }
+
+    SECTION("linear fit with confidence interval")
+    {
+        std::vector<double> x, y;
+        for (auto i = 0; i < 100; ++i)
+        {
+            x.push_back(i);
+            y.push_back(1.0 + 2.0 * i + (i % 2 ? 1.0 : -1.0));
+        }
+        const Fit fit(x, y);
+        const auto coeffs = fit.coefficients();
+        CHECK(coeffs[0] == Approx(1.0).margin(0.1));
+        CHECK(coeffs[1] == Approx(2.0).epsilon(1e-3));
+        CHECK(fit.residualStdDev() == Approx(1.0).epsilon(0.02));
+        // At the mean of x, the standard error of the fitted value is σ / √n
+        const auto [low, high] = fit.confidenceInterval(49.5, 0.95);
+        CHECK(high - low == Approx(2.0 * 1.959964 * fit.residualStdDev() / 10.0).epsilon(1e-4));
+        CHECK(internal::normalquantile(0.975) == Approx(1.959964).epsilon(1e-6));
+    }
+
+    SECTION("exponential fit")
+    {
+        std::vector<double> x, y;
+        for (auto i = 0; i < 50; ++i)
+        {
+            x.push_back(0.1 * i);
+            y.push_back(2.0 * std::exp(-0.7 * x.back()));
+        }
+        y[3] = -1.0; // skipped, as ln y is undefined
+        const Fit fit(x, y, FitModel::exponential());
+        CHECK(fit.count() == 49);
+        const auto coeffs = fit.coefficients();
+        CHECK(coeffs[0] == Approx(2.0));
+        CHECK(coeffs[1] == Approx(-0.7));
+        CHECK(fit(1.0) == Approx(2.0 * std::exp(-0.7)));
+    }
+
+    SECTION("rows skipped by the fit do not widen its range")
+    {
+        // Rows far away from the others would squeeze the fitted ones into a sliver of the basis if they counted
+        std::vector<double> x, y;
+        for (auto i = 0; i < 50; ++i)
+        {
+            x.push_back(i);
+            y.push_back(3.0 + 2.0 * i);
+        }
+        x.push_back(1e15);
+        y.push_back(NaN);
+        const Fit fit(x, y);
+        CHECK(fit.count() == 50);
+        CHECK(fit.coefficients()[0] == Approx(3.0));
+        CHECK(fit.coefficients()[1] == Approx(2.0));
+
+        for (auto i = 0; i < 50; ++i)
+            y[i] = 2.0 * std::exp(-0.1 * x[i]);
+        x.back() = -1e15;
+        y.back() = -1.0;
+        const Fit exponential(x, y, FitModel::exponential());
+        CHECK(exponential.count() == 50);
+        CHECK(exponential.coefficients()[0] == Approx(2.0));
+        CHECK(exponential.coefficients()[1] == Approx(-0.1));
+    }
+}
@@ -0,0 +1,112 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Hexbin.hpp>
+using namespace sciplot;
+
+TEST_CASE("Hexbin", "[hexbin]")
+{
+    const auto layout = internal::hexlayout(0.0, 4.0, 0.0, 2.0, 4);
+    REQUIRE(layout.nx == 4);
+    REQUIRE(layout.ny == 2);
+    const auto ones = [](std::size_t) { return 1.0; };
+
+    SECTION("points are assigned to the nearest hexagon center")
+    {
+        for (auto k : {std::size_t(0), std::size_t(7), std::size_t(14), std::size_t(15), std::size_t(22)})
+        {
+            const auto [cx, cy] = layout.center(k);
+            CHECK(layout.index(cx, cy) == k);
+            // Move slightly towards the middle of the grid, so that the point stays inside it
+            const auto sx = cx < 2.0 ? 0.1 : -0.1;
+            const auto sy = cy < 1.0 ? 0.1 : -0.1;
+            CHECK(layout.index(cx + sx * layout.dx, cy + sy * layout.dy) == k);
+        }
+        CHECK(layout.index(-1.0, 0.0) == layout.numcells());
+        CHECK(layout.index(NaN, 0.0) == layout.numcells());
+    }
+
+    SECTION("counts with weights")
+    {
+        const std::vector<double> x = {0.0, 0.1, 0.5, 5.0};
+        const std::vector<double> y = {0.0, 0.0, 0.5, 0.0};
+        const std::vector<double> weights = {1.0, 2.0, 4.0, 8.0};
+        const auto counts = internal::hexbincounts(x, y, x.size(), layout, [&](std::size_t i) { return weights[i]; });
+        REQUIRE(counts.size() == layout.numcells());
+        CHECK(counts[0] == 3.0);
+        CHECK(counts[(layout.nx + 1) * (layout.ny + 1)] == 4.0);
+        auto total = 0.0;
+        for (auto c : counts)
+            total += c;
+        CHECK(total == 7.0);
+    }
+
+    SECTION("hexagons span the range of the points")
+    {
+        const std::vector<double> x = {1.0, 2.0, 3.0};
+        const std::vector<double> y = {5.0, 5.0, 6.0};
+        const auto [hexes, counts] = internal::hexbin(x, y, x.size(), 10, ones);
+        CHECK(hexes.xmin == 1.0);
+        CHECK(hexes.ymin == 5.0);
+        CHECK(hexes.nx == 10);
+        CHECK(hexes.ny == 5);
+    }
+
+    SECTION("coarser grids merge the hexagons of finer ones")
+    {
+        std::vector<double> x, y;
+        for (auto i = 0; i < 1000; ++i)
+        {
+            x.push_back(std::sin(0.37 * i) * i);
+            y.push_back(std::cos(0.53 * i) * (1000 - i));
+        }
+        const auto [fine, finecounts] = internal::hexbin(x, y, x.size(), 40, ones);
+        const auto [coarse, counts] = internal::coarsenhexbin(fine, finecounts, 10);
+        const auto [expected, expectedcounts] = internal::hexbin(x, y, x.size(), 10, ones);
+        CHECK(coarse.nx == expected.nx);
+        CHECK(coarse.ny == expected.ny);
+        CHECK(coarse.xmin == expected.xmin);
+        CHECK(coarse.dx == Approx(expected.dx));
+        CHECK(coarse.dy == Approx(expected.dy));
+        REQUIRE(counts.size() == expectedcounts.size());
+        auto total = 0.0;
+        for (auto c : counts)
+            total += c;
+        CHECK(total == 1000.0);
+        // The hexagons of the coarser grid only differ by the points of finer hexagons straddling their borders
+        auto moved = 0.0;
+        for (std::size_t k = 0; k < counts.size(); ++k)
+            moved += std::abs(counts[k] - expectedcounts[k]);
+        CHECK(moved < 0.25 * total);
+    }
+}
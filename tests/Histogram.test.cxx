@@ -0,0 +1,166 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Histogram.hpp>
+using namespace sciplot;
+
+TEST_CASE("Histogram", "[histogram]")
+{
+    const std::vector<double> samples = {0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, NaN};
+    const auto ones = [](std::size_t) { return 1.0; };
+
+    SECTION("uniform bins over the range of the samples")
+    {
+        const auto [layout, counts] = internal::histogram(samples, samples.size(), Bins::count(4), ones);
+        CHECK(layout.edges == std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0});
+        CHECK(counts == std::vector<double>{2.0, 2.0, 2.0, 3.0});
+    }
+
+    SECTION("uniform bins over a given range")
+    {
+        const auto [layout, counts] = internal::histogram(samples, samples.size(), Bins::uniform(1.0, 3.0, 2), ones);
+        CHECK(counts == std::vector<double>{2.0, 3.0});
+    }
+
+    SECTION("explicit edges and weights")
+    {
+        const std::vector<double> weights = {1.0, 1.0, 2.0, 2.0, 3.0, 3.0, 4.0, 4.0, 5.0, 6.0};
+        const auto [layout, counts] = internal::histogram(samples, samples.size(), Bins::edges({0.0, 0.75, 3.0}), [&](std::size_t i) { return weights[i]; });
+        CHECK(counts == std::vector<double>{2.0, 14.0});
+    }
+
+    SECTION("logarithmic bins")
+    {
+        const std::vector<double> values = {1.0, 5.0, 11.0, 50.0, 100.0, -1.0};
+        const auto [layout, counts] = internal::histogram(values, values.size(), Bins::log(2), ones);
+        CHECK(layout.edges.front() == 1.0);
+        CHECK(layout.edges[1] == Approx(10.0));
+        CHECK(layout.edges.back() == 100.0);
+        CHECK(counts == std::vector<double>{2.0, 3.0});
+    }
+
+    SECTION("automatic number of bins")
+    {
+        CHECK(internal::sturgesbins(1000) == 11);
+        CHECK(Bins::sturges().layout(samples, samples.size()).numbins() == 5);
+        CHECK(Bins::freedmanDiaconis().layout(samples, samples.size()).numbins() == 3);
+        CHECK(Bins::automatic().layout(samples, samples.size()).numbins() == 5);
+    }
+
+    SECTION("automatic number of bins for heavy-tailed samples")
+    {
+        // Quantiles of the Cauchy distribution span many thousands of interquartile ranges
+        std::vector<double> cauchy(100000);
+        for (std::size_t i = 0; i < cauchy.size(); ++i)
+            cauchy[i] = std::tan(PI * ((i + 0.5) / cauchy.size() - 0.5));
+        CHECK(Bins::freedmanDiaconis().layout(cauchy, cauchy.size()).numbins() == internal::DEFAULT_HISTOGRAM_MAX_BINS);
+        CHECK(Bins::automatic().layout(cauchy, cauchy.size()).numbins() == internal::DEFAULT_HISTOGRAM_MAX_BINS);
+        const auto [layout, counts] = internal::histogram(cauchy, cauchy.size(), Bins::automatic(), ones);
+        CHECK(counts.size() == internal::DEFAULT_HISTOGRAM_MAX_BINS);
+    }
+
+    SECTION("invalid edges")
+    {
+        CHECK_THROWS(Bins::edges({1.0}).layout(samples, samples.size()));
+        CHECK_THROWS(Bins::edges({2.0, 1.0}).layout(samples, samples.size()));
+    }
+}
+
+TEST_CASE("Histogram accumulator", "[histogram]")
+{
+    SECTION("fixed bins")
+    {
+        Histogram histogram(Bins::uniform(0.0, 4.0, 4));
+        histogram.add(std::vector<double>{0.5, 1.5, 1.5, 9.0});
+        histogram.add(std::vector<double>{3.5, 2.5}, std::vector<double>{2.0, 0.5});
+        CHECK(histogram.edges() == std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0});
+        CHECK(histogram.counts() == std::vector<double>{1.0, 2.0, 0.5, 2.0});
+        CHECK(histogram.total() == 5.5);
+    }
+
+    SECTION("adaptive bins grow to cover new samples")
+    {
+        Histogram histogram(Bins::count(4));
+        histogram.add(std::vector<double>{0.0, 1.0, 2.0, 3.0});
+        CHECK(histogram.edges() == std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0});
+        histogram.add(std::vector<double>{-3.0, 6.0});
+        CHECK(histogram.edges() == std::vector<double>{-4.0, 0.0, 4.0, 8.0, 12.0});
+        CHECK(histogram.counts() == std::vector<double>{1.0, 4.0, 1.0, 0.0});
+    }
+
+    SECTION("merging adaptive histograms filled separately")
+    {
+        Histogram a(Bins::count(8));
+        Histogram b(Bins::count(8));
+        Histogram all(Bins::count(8));
+        const std::vector<double> first = {0.1, 0.2, 0.3, 0.4};
+        const std::vector<double> second = {10.0, 20.0, 30.0};
+        a.add(first);
+        b.add(second);
+        all.add(first).add(second);
+        a.merge(b);
+        CHECK(a.edges() == all.edges());
+        CHECK(a.counts() == all.counts());
+        CHECK(a.total() == 7.0);
+    }
+
+    SECTION("merging fixed histograms requires the same edges")
+    {
+        Histogram a(Bins::uniform(0.0, 1.0, 2));
+        Histogram b(Bins::uniform(0.0, 2.0, 2));
+        CHECK_THROWS(a.merge(b));
+        CHECK_THROWS(Histogram(Bins::sturges()));
+    }
+}
+
+TEST_CASE("Histogram 2D", "[histogram]")
+{
+    const std::vector<double> x = {0.5, 1.5, 1.5, 0.5, 5.0, NaN};
+    const std::vector<double> y = {0.5, 0.5, 1.5, 1.5, 0.5, 0.5};
+    const std::vector<double> weights = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    SECTION("counts are stored row by row")
+    {
+        const auto [layoutx, layouty, counts] = internal::histogram2d(x, y, x.size(), Bins::uniform(0.0, 2.0, 2), Bins::uniform(0.0, 2.0, 2), [&](std::size_t i) { return weights[i]; });
+        CHECK(layoutx.edges == std::vector<double>{0.0, 1.0, 2.0});
+        CHECK(layouty.edges == std::vector<double>{0.0, 1.0, 2.0});
+        CHECK(counts == std::vector<double>{1.0, 2.0, 4.0, 3.0});
+    }
+
+    SECTION("equally spaced edges")
+    {
+        CHECK(internal::equallyspaced({0.0, 0.1, 0.2, 0.3}));
+        CHECK_FALSE(internal::equallyspaced({1.0, 10.0, 100.0}));
+        CHECK_FALSE(internal::equallyspaced({1.0}));
+    }
+}
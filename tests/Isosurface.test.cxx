@@ -0,0 +1,98 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Isosurface.hpp>
+#include <sciplot/Utils.hpp>
+#include <sciplot/VolumeView.hpp>
+using namespace sciplot;
+
+TEST_CASE("Isosurface", "[isosurface]")
+{
+    SECTION("marching cubes table")
+    {
+        const auto& table = internal::marchingcubestable();
+        CHECK(table[0].empty());
+        CHECK(table[255].empty());
+        // A single corner is cut off by one triangle, and an edge of two corners by a quadrilateral
+        CHECK(table[1].size() == 1);
+        CHECK(table[254].size() == 1);
+        CHECK(table[3].size() == 2);
+        // Two opposite corners of the cube are cut off separately
+        CHECK(table[1 | 128].size() == 2);
+    }
+
+    SECTION("closed surface of a sphere")
+    {
+        // A grid spanning several slabs, with the sphere crossing the layers between them
+        const std::size_t n = 40;
+        const auto grid = internal::gridpoints(-1.0, 1.0, n);
+        std::vector<double> values(n * n * n);
+        for (std::size_t k = 0; k < n; ++k)
+            for (std::size_t j = 0; j < n; ++j)
+                for (std::size_t i = 0; i < n; ++i)
+                    values[(k * n + j) * n + i] = grid[i] * grid[i] + grid[j] * grid[j] + grid[k] * grid[k];
+        const VolumeView volume(values, n, n);
+        const auto mesh = internal::isosurface(grid, grid, grid, n, n, n, volume, 0.64);
+        REQUIRE(mesh.numtriangles() > 0);
+
+        for (std::size_t v = 0; v < mesh.x.size(); ++v)
+            CHECK(std::sqrt(mesh.x[v] * mesh.x[v] + mesh.y[v] * mesh.y[v] + mesh.z[v] * mesh.z[v]) == Approx(0.8).margin(0.01));
+
+        // Every vertex appears once, so every edge of the mesh is shared by exactly two triangles, and the surface has the Euler characteristic of a sphere
+        std::map<std::pair<std::size_t, std::size_t>, int> edges;
+        for (std::size_t t = 0; t < mesh.numtriangles(); ++t)
+        {
+            for (std::size_t m = 0; m < 3; ++m)
+            {
+                const auto a = mesh.triangles[3 * t + m];
+                const auto b = mesh.triangles[3 * t + (m + 1) % 3];
+                ++edges[{std::min(a, b), std::max(a, b)}];
+            }
+        }
+        CHECK(std::all_of(edges.begin(), edges.end(), [](const auto& edge) { return edge.second == 2; }));
+        const auto euler = static_cast<long>(mesh.x.size()) - static_cast<long>(edges.size()) + static_cast<long>(mesh.numtriangles());
+        CHECK(euler == 2);
+    }
+
+    SECTION("degenerate grids")
+    {
+        const std::vector<double> values(8, 1.0);
+        const std::vector<double> x = {0.0, 1.0};
+        CHECK(internal::isosurface(x, x, x, 2, 2, 2, VolumeView(values, 2, 2), 0.5).numtriangles() == 0);
+        CHECK(internal::isosurface(x, x, x, 2, 2, 1, VolumeView(values, 2, 2), 1.5).numtriangles() == 0);
+    }
+}
@@ -0,0 +1,124 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/LevelOfDetail.hpp>
+using namespace sciplot;
+
+TEST_CASE("LevelOfDetail", "[lod]")
+{
+    std::vector<double> x(1000);
+    std::vector<double> y(1000);
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = static_cast<double>(i);
+        y[i] = static_cast<double>((i * 37) % 101);
+    }
+    y[500] = 1000.0;
+    y[501] = -1000.0;
+
+    const LevelOfDetail lod(x, y);
+
+    CHECK(lod.size() == 1000);
+    CHECK(lod.levels() == 9);
+
+    SECTION("query keeps the extrema of every column")
+    {
+        const auto curve = lod.query(10);
+        CHECK(curve.x.size() <= 40);
+        CHECK(std::find(curve.y.begin(), curve.y.end(), 1000.0) != curve.y.end());
+        CHECK(std::find(curve.y.begin(), curve.y.end(), -1000.0) != curve.y.end());
+        CHECK(std::is_sorted(curve.x.begin(), curve.x.end()));
+        CHECK(curve.x.front() == 0.0);
+        CHECK(curve.x.back() == 999.0);
+    }
+
+    SECTION("query returns all points when the window is narrower than the width")
+    {
+        const auto curve = lod.query(100.0, 109.0, 100);
+        REQUIRE(curve.x.size() == 12); // 10 points in the window and one neighbor on each side
+        CHECK(curve.x.front() == 99.0);
+        CHECK(curve.x.back() == 110.0);
+        CHECK(curve.y[1] == y[100]);
+    }
+
+    SECTION("save and load")
+    {
+        lod.save("lod.bin");
+        const auto loaded = LevelOfDetail::load("lod.bin");
+        std::remove("lod.bin");
+        CHECK(loaded.size() == lod.size());
+        CHECK(loaded.query(313.0, 787.0, 7).y == lod.query(313.0, 787.0, 7).y);
+    }
+
+    SECTION("load rejects truncated, foreign and corrupted files")
+    {
+        lod.save("lod.bin");
+        std::string bytes;
+        {
+            std::ifstream file("lod.bin", std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        const auto loadwith = [](const std::string& content) {
+            {
+                std::ofstream file("lod.bin", std::ios::binary);
+                file << content;
+            }
+            return LevelOfDetail::load("lod.bin");
+        };
+        CHECK_NOTHROW(loadwith(bytes));
+        CHECK_THROWS_AS(loadwith(bytes.substr(0, bytes.size() - 1)), std::runtime_error);
+        CHECK_THROWS_AS(loadwith(bytes + "x"), std::runtime_error);
+        CHECK_THROWS_AS(loadwith("not a pyramid"), std::runtime_error);
+
+        auto swapped = bytes;
+        std::reverse(swapped.begin() + 11, swapped.begin() + 15); // the byte order mark
+        CHECK_THROWS_AS(loadwith(swapped), std::runtime_error);
+
+        auto huge = bytes;
+        huge[15 + 7] = '\x7f'; // the most significant byte of the size on little-endian machines
+        huge[15] = '\x7f'; // or on big-endian machines
+        CHECK_THROWS_AS(loadwith(huge), std::runtime_error);
+
+        auto corrupted = bytes;
+        const auto levels = 15 + 8 + 16 * x.size();
+        corrupted[levels] = '\x7f'; // the first index of the first level no longer points into its block
+        CHECK_THROWS_AS(loadwith(corrupted), std::runtime_error);
+
+        std::remove("lod.bin");
+        CHECK_THROWS_AS(LevelOfDetail::load("lod.bin"), std::runtime_error);
+    }
+}
@@ -0,0 +1,84 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+
+// C++ includes
+#include <cstring>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/MatrixView.hpp>
+#include <sciplot/Utils.hpp>
+using namespace sciplot;
+
+TEST_CASE("MatrixView", "[matrixview]")
+{
+    // A 3 x 4 matrix stored row after row
+    const std::vector<double> values = {0.0, 1.0, 2.0, 3.0, 10.0, 11.0, 12.0, 13.0, 20.0, 21.0, 22.0, 23.0};
+
+    SECTION("contiguous and strided views")
+    {
+        const MatrixView matrix(values, 3);
+        CHECK(matrix.rows() == 3);
+        CHECK(matrix.cols() == 4);
+        CHECK(matrix(2, 1) == 21.0);
+
+        // Every other column of the last two rows
+        const MatrixView strided(values.data() + 4, 2, 2, 4, 2);
+        CHECK(strided(0, 0) == 10.0);
+        CHECK(strided(0, 1) == 12.0);
+        CHECK(strided(1, 1) == 22.0);
+
+        const auto transposed = matrix.transposed();
+        CHECK(transposed.rows() == 4);
+        CHECK(transposed.cols() == 3);
+        CHECK(transposed(1, 2) == 21.0);
+
+        // The rows in reverse order, with a negative stride
+        const MatrixView flipped(values.data() + 8, 3, 4, -4, 1);
+        CHECK(flipped(0, 3) == 23.0);
+        CHECK(flipped(2, 0) == 0.0);
+    }
+
+    SECTION("written as a binary matrix without copying")
+    {
+        const MatrixView strided(values.data() + 4, 2, 2, 4, 2);
+        const std::vector<double> x = {0.5, 1.5};
+        const std::vector<double> y = {-1.0, 1.0};
+        const auto bytes = gnuplot::binarymatrixof(x, y, strided);
+        REQUIRE(bytes.size() == 9 * sizeof(float));
+        float floats[9];
+        std::memcpy(floats, bytes.data(), bytes.size());
+        CHECK(floats[0] == 2.0f);
+        CHECK(floats[3] == -1.0f);
+        CHECK(floats[4] == 10.0f);
+        CHECK(floats[5] == 12.0f);
+        CHECK(floats[6] == 1.0f);
+        CHECK(floats[8] == 22.0f);
+    }
+}
@@ -0,0 +1,154 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/MeshDecimation.hpp>
+#include <sciplot/Utils.hpp>
+#include <sciplot/VolumeView.hpp>
+using namespace sciplot;
+
+TEST_CASE("MeshDecimation", "[meshdecimation]")
+{
+    const auto area = [](const internal::TriangleMesh& mesh) {
+        auto sum = 0.0;
+        for (std::size_t t = 0; t < mesh.numtriangles(); ++t)
+        {
+            const auto a = mesh.triangles[3 * t], b = mesh.triangles[3 * t + 1], c = mesh.triangles[3 * t + 2];
+            const double u[3] = {mesh.x[b] - mesh.x[a], mesh.y[b] - mesh.y[a], mesh.z[b] - mesh.z[a]};
+            const double w[3] = {mesh.x[c] - mesh.x[a], mesh.y[c] - mesh.y[a], mesh.z[c] - mesh.z[a]};
+            sum += 0.5 * std::sqrt(std::pow(u[1] * w[2] - u[2] * w[1], 2) + std::pow(u[2] * w[0] - u[0] * w[2], 2) + std::pow(u[0] * w[1] - u[1] * w[0], 2));
+        }
+        return sum;
+    };
+
+    SECTION("quadrics")
+    {
+        // The planes x = 1, y = 2, and z = 3 meet at a single point of zero error
+        internal::Quadric quadric;
+        quadric.addplane(1.0, 0.0, 0.0, -1.0, 1.0);
+        quadric.addplane(0.0, 1.0, 0.0, -2.0, 1.0);
+        quadric.addplane(0.0, 0.0, 1.0, -3.0, 2.0);
+        std::array<double, 3> p = {};
+        REQUIRE(quadric.optimum(p));
+        CHECK(p[0] == Approx(1.0));
+        CHECK(p[1] == Approx(2.0));
+        CHECK(p[2] == Approx(3.0));
+        CHECK(quadric.error(p[0], p[1], p[2]) == Approx(0.0).margin(1e-12));
+        CHECK(quadric.error(1.0, 2.0, 4.0) == Approx(2.0));
+
+        // Parallel planes leave a whole plane of optima
+        internal::Quadric flat;
+        flat.addplane(0.0, 0.0, 1.0, 0.0, 1.0);
+        flat.addplane(0.0, 0.0, 1.0, -1.0, 1.0);
+        CHECK_FALSE(flat.optimum(p));
+    }
+
+    SECTION("flat meshes keep their border")
+    {
+        // A unit square split into 20 x 20 cells of two triangles each
+        const std::size_t n = 21;
+        const auto grid = internal::gridpoints(0.0, 1.0, n);
+        internal::TriangleMesh mesh;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                mesh.x.push_back(grid[i]);
+                mesh.y.push_back(grid[j]);
+                mesh.z.push_back(0.0);
+            }
+        }
+        for (std::size_t j = 0; j + 1 < n; ++j)
+        {
+            for (std::size_t i = 0; i + 1 < n; ++i)
+            {
+                const auto v = j * n + i;
+                mesh.triangles.insert(mesh.triangles.end(), {v, v + 1, v + n + 1, v, v + n + 1, v + n});
+            }
+        }
+        const auto decimated = internal::decimatemesh(mesh, mesh.numtriangles(), 1e-6);
+        CHECK(decimated.numtriangles() < mesh.numtriangles() / 4);
+        CHECK(area(decimated) == Approx(1.0));
+        CHECK(*std::min_element(decimated.x.begin(), decimated.x.end()) == Approx(0.0).margin(1e-12));
+        CHECK(*std::max_element(decimated.y.begin(), decimated.y.end()) == Approx(1.0));
+        for (const auto z : decimated.z)
+            CHECK(z == Approx(0.0).margin(1e-12));
+
+        // Nothing changes without a face target and a tolerance
+        CHECK(internal::decimatemesh(mesh, mesh.numtriangles(), -1.0).numtriangles() == mesh.numtriangles());
+    }
+
+    SECTION("closed meshes down to a face count")
+    {
+        const std::size_t n = 30;
+        const auto grid = internal::gridpoints(-1.0, 1.0, n);
+        std::vector<double> values(n * n * n);
+        for (std::size_t k = 0; k < n; ++k)
+            for (std::size_t j = 0; j < n; ++j)
+                for (std::size_t i = 0; i < n; ++i)
+                    values[(k * n + j) * n + i] = grid[i] * grid[i] + grid[j] * grid[j] + grid[k] * grid[k];
+        const auto mesh = internal::isosurface(grid, grid, grid, n, n, n, VolumeView(values, n, n), 0.64);
+        const auto decimated = internal::decimatemesh(mesh, 200, -1.0);
+        CHECK(decimated.numtriangles() <= 200);
+        CHECK(decimated.numtriangles() >= 150);
+        for (std::size_t v = 0; v < decimated.x.size(); ++v)
+            CHECK(std::sqrt(decimated.x[v] * decimated.x[v] + decimated.y[v] * decimated.y[v] + decimated.z[v] * decimated.z[v]) == Approx(0.8).margin(0.05));
+
+        // The surface remains closed, with every edge shared by two triangles
+        std::map<std::pair<std::size_t, std::size_t>, int> edges;
+        for (std::size_t t = 0; t < decimated.numtriangles(); ++t)
+        {
+            for (std::size_t m = 0; m < 3; ++m)
+            {
+                const auto a = decimated.triangles[3 * t + m];
+                const auto b = decimated.triangles[3 * t + (m + 1) % 3];
+                ++edges[{std::min(a, b), std::max(a, b)}];
+            }
+        }
+        CHECK(std::all_of(edges.begin(), edges.end(), [](const auto& edge) { return edge.second == 2; }));
+    }
+
+    SECTION("specifications")
+    {
+        CHECK(MeshDecimation::none().maxfaces() == 0);
+        CHECK(MeshDecimation::none().maxpixels() < 0.0);
+        CHECK(MeshDecimation::faces(1000).maxfaces() == 1000);
+        CHECK(MeshDecimation::pixels(0.5).maxpixels() == 0.5);
+        CHECK_THROWS(MeshDecimation::faces(0));
+        CHECK_THROWS(MeshDecimation::pixels(0.0));
+    }
+}
@@ -0,0 +1,84 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <atomic>
+#include <stdexcept>
+
+// sciplot includes
+#include <sciplot/Parallel.hpp>
+using namespace sciplot;
+
+TEST_CASE("Parallel", "[parallel]")
+{
+    SECTION("parallelfor covers the range exactly once")
+    {
+        std::vector<int> visits(1000, 0);
+        std::atomic<std::size_t> chunks = 0;
+        internal::parallelfor(visits.size(), 4, [&](std::size_t begin, std::size_t end, std::size_t) {
+            chunks += 1;
+            for (auto i = begin; i < end; ++i)
+                visits[i] += 1;
+        });
+        CHECK(chunks == 4);
+        CHECK(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+    }
+
+    SECTION("parallelfor rethrows exceptions")
+    {
+        const auto fails = [&] {
+            internal::parallelfor(100, 3, [&](std::size_t, std::size_t, std::size_t ithread) {
+                if (ithread == 2)
+                    throw std::runtime_error("failure");
+            });
+        };
+        CHECK_THROWS_AS(fails(), std::runtime_error);
+    }
+
+    SECTION("parallelsort")
+    {
+        std::vector<double> values(1001);
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<double>((i * 7919) % 1009);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        for (std::size_t nthreads : {1, 2, 3, 5, 8})
+        {
+            auto sorted = values;
+            internal::parallelsort(sorted, nthreads);
+            CHECK(sorted == expected);
+        }
+    }
+
+    SECTION("numthreads")
+    {
+        CHECK(internal::numthreads(0) == 1);
+        CHECK(internal::numthreads(10, 100) == 1);
+        CHECK(internal::numthreads(1000000, 1) >= 1);
+    }
+}
@@ -0,0 +1,449 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <cmath>
+#include <fstream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Plot2D.hpp>
+using namespace sciplot;
+
+namespace {
+
+/// Return the names of the binary data files referenced in the given plot script.
+auto binaryfiles(const std::string& script) -> std::vector<std::string>
+{
+    std::vector<std::string> files;
+    const std::regex pattern("'(plot[0-9]+-[0-9]+\\.bin)'");
+    for (auto it = std::sregex_iterator(script.begin(), script.end(), pattern); it != std::sregex_iterator(); ++it)
+        files.push_back((*it)[1]);
+    return files;
+}
+
+/// Return the size of the file with given name in bytes.
+auto filesize(const std::string& filename) -> std::size_t
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    return file ? static_cast<std::size_t>(file.tellg()) : 0;
+}
+
+/// Return the index gnuplot gives to every data set of the text data file referenced in the given plot script, in the order they are written.
+/// The index grows by one after every pair of blank lines, which ends a data set.
+auto datasetindices(const std::string& script) -> std::vector<std::size_t>
+{
+    std::smatch match;
+    std::regex_search(script, match, std::regex("'(plot[0-9]+\\.dat)'"));
+    std::ifstream file(match[1].str());
+    std::vector<std::size_t> indices;
+    std::size_t index = 0;
+    std::size_t blanks = 0;
+    for (std::string line; std::getline(file, line);)
+    {
+        blanks = line.empty() ? blanks + 1 : 0;
+        if (blanks == 2)
+            ++index;
+        if (line.rfind("# DATASET #", 0) == 0)
+            indices.push_back(index);
+    }
+    return indices;
+}
+
+} // namespace
+
+TEST_CASE("Plot2D", "[plot2d]")
+{
+    const auto n = 100000;
+    std::vector<double> x(n), y(n), ydelta(n, 0.1);
+    for (auto i = 0; i < n; ++i)
+    {
+        x[i] = i;
+        y[i] = (i % 7) * 0.5;
+    }
+
+    std::vector<double> samples(n);
+    for (auto i = 0; i < n; ++i)
+        samples[i] = std::sin(0.001 * i) * (i % 13);
+    SECTION("Data is reduced to the default canvas width")
+    {
+        Plot2D plot;
+        plot.drawErrorBarsYEnvelope(x, y, ydelta);
+        CHECK(plot.renderStats().draws.back().rowsout == internal::DEFAULT_FIGURE_WIDTH);
+    }
+
+    SECTION("Broken curves are recorded without being reduced")
+    {
+        std::vector<double> broken(y);
+        broken[n / 2] = NaN;
+        Plot2D plot;
+        plot.pointBudget(300);
+        plot.drawBrokenCurve(x, broken);
+        REQUIRE(plot.renderStats().draws.size() == 1);
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.with == "lines");
+        CHECK(stats.rowsin == n);
+        CHECK(stats.rowsout == n);
+        CHECK(stats.allowance == 300);
+    }
+
+    SECTION("Data is reduced to the plot size")
+    {
+        Plot2D plot;
+        plot.size(800, 600);
+        plot.drawErrorBarsYEnvelope(x, y, ydelta);
+        CHECK(plot.renderStats().draws.back().rowsout == 800);
+    }
+
+    SECTION("Data is reduced to the canvas width given as resolution")
+    {
+        Plot2D plot;
+        plot.size(800, 600);
+        plot.resolution(1600, 900);
+        plot.drawErrorBarsYEnvelope(x, y, ydelta);
+        CHECK(plot.renderStats().draws.back().rowsin == n);
+        CHECK(plot.renderStats().draws.back().rowsout == 1600);
+    }
+
+    SECTION("Curves are reduced to the point budget")
+    {
+        Plot2D plot;
+        plot.pointBudget(100);
+        plot.drawCurve(x, y);
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.rowsin == n);
+        CHECK(stats.allowance == 100);
+        CHECK(stats.rowsout <= 100);
+        CHECK(stats.rowsout >= 4);
+    }
+
+    SECTION("Point budgets below four rows are raised to four")
+    {
+        Plot2D plot;
+        plot.pointBudget(1);
+        plot.drawCurve(x, y);
+        CHECK(plot.renderStats().draws.back().allowance == 4);
+        CHECK(plot.renderStats().draws.back().rowsout <= 4);
+    }
+
+    SECTION("Step curves keep the rows that set the width of their first and last steps")
+    {
+        const std::vector<double> xs = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+        const std::vector<double> ys = {1.0, 1.0, 1.0, 1.0, 2.0, 2.0, 2.0, 2.0};
+        Plot2D plot;
+        plot.drawStepsHistogram(xs, ys);
+        plot.drawWithVecs("steps", xs, ys);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 2);
+        // The second and second to last rows fix how far histeps extends the leading and trailing runs
+        CHECK(draws[0].rowsin == 8);
+        CHECK(draws[0].rowsout == 6);
+        CHECK(draws[1].rowsout == 6);
+    }
+
+    SECTION("2D histograms fit the point budget and are written as binary files")
+    {
+        Plot2D plot;
+        plot.pointBudget(1000);
+        plot.drawHistogram2D(x, y, Bins::count(100), Bins::count(50));
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.with == "image");
+        CHECK(stats.rowsin == 100 * 50);
+        CHECK(stats.rowsout <= 1000);
+        CHECK(stats.estimatedseconds > 0.0);
+
+        const auto files = binaryfiles(plot.repr());
+        REQUIRE(files.size() == 1);
+        plot.savePlotData();
+        // A binary matrix holds a float for every node and one more for every row and column, giving its coordinates
+        const auto [mx, my] = internal::fitwithin(100, 50, 1000, true);
+        CHECK(filesize(files[0]) == (mx + 1) * (my + 1) * sizeof(float));
+        plot.cleanup();
+        CHECK(filesize(files[0]) == 0);
+    }
+
+    SECTION("Hexbins fit the point budget")
+    {
+        Plot2D plot;
+        plot.pointBudget(300);
+        plot.drawHexbin(x, samples, 100);
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.rowsin == n);
+        CHECK(stats.allowance == 300);
+        CHECK(stats.rowsout > 0);
+        CHECK(stats.rowsout <= 300);
+        CHECK(stats.estimatedseconds > 0.0);
+    }
+
+    SECTION("Hexbins without finite points are drawn without hexagons")
+    {
+        const std::vector<double> nans = {NaN, NaN, NaN};
+        const std::vector<double> ones = {1.0, 2.0, 3.0};
+        Plot2D plot;
+        plot.drawHexbin(nans, ones, 10);
+        plot.drawHexbin(std::vector<double>{}, std::vector<double>{}, 10);
+        plot.drawCurve(x, y);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 3);
+        CHECK(draws[0].rowsin == 3);
+        CHECK(draws[0].rowsout == 0);
+        CHECK(draws[1].rowsout == 0);
+
+        const auto script = plot.repr();
+        CHECK(script.find("index 2 with lines linestyle 3") != std::string::npos);
+        plot.savePlotData();
+        CHECK(datasetindices(script) == std::vector<std::size_t>{0, 1, 2});
+        plot.cleanup();
+    }
+
+    SECTION("Box plots fit the point budget")
+    {
+        Plot2D plot;
+        plot.pointBudget(300);
+        plot.drawBoxPlot(std::vector<std::vector<double>>{samples, x, y});
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.rowsin == 3 * n);
+        CHECK(stats.allowance == 300);
+        CHECK(stats.rowsout > 0);
+        CHECK(stats.rowsout <= 300);
+        CHECK(stats.estimatedseconds > 0.0);
+    }
+
+    SECTION("Ensembles fit the point budget")
+    {
+        std::vector<std::vector<double>> runs(20, std::vector<double>(n));
+        for (auto r = 0; r < 20; ++r)
+            for (auto i = 0; i < n; ++i)
+                runs[r][i] = r + y[i];
+
+        Plot2D plot;
+        plot.pointBudget(300);
+        plot.drawEnsemble(x, runs);
+        plot.drawEnsembleRuns(x, runs);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 2);
+        for (const auto& draw : draws)
+        {
+            CHECK(draw.rowsin == 20 * n);
+            CHECK(draw.allowance == 300);
+            CHECK(draw.rowsout > 0);
+            CHECK(draw.rowsout <= draw.allowance);
+            CHECK(draw.estimatedseconds > 0.0);
+        }
+        CHECK(plot.renderStats().rowsin() == 40 * n);
+    }
+
+    SECTION("Ensemble percentiles must pair up around the median")
+    {
+        const std::vector<std::vector<double>> runs = {x, y, x};
+        Plot2D plot;
+        CHECK_THROWS_AS(plot.drawEnsemble(x, runs, {5.0, 25.0}), std::invalid_argument);
+        CHECK_THROWS_AS(plot.drawEnsemble(x, runs, {5.0, 25.0, 75.0}), std::invalid_argument);
+        CHECK(plot.renderStats().draws.empty());
+        plot.drawEnsemble(x, runs, {75.0, 50.0, 25.0, 25.0});
+        const auto script = plot.repr();
+        CHECK(script.find("index 0 using 1:2:4 notitle with filledcurves") != std::string::npos);
+        CHECK(script.find("index 0 using 1:3 with lines") != std::string::npos);
+    }
+
+    SECTION("ECDFs fit the point budget")
+    {
+        Plot2D plot;
+        plot.pointBudget(300);
+        plot.drawECDF(samples);
+        plot.drawCCDF(samples, true);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 2);
+        for (const auto& draw : draws)
+        {
+            CHECK(draw.rowsin == n);
+            CHECK(draw.allowance == 300);
+            CHECK(draw.rowsout > 0);
+            CHECK(draw.rowsout <= draw.allowance);
+            CHECK(draw.estimatedseconds > 0.0);
+        }
+    }
+
+    SECTION("Violins fit the point budget")
+    {
+        Plot2D plot;
+        plot.pointBudget(300);
+        plot.drawViolin(std::vector<std::vector<double>>{samples, x, y});
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.rowsin == 3 * n);
+        CHECK(stats.allowance == 300);
+        CHECK(stats.rowsout > 0);
+        CHECK(stats.rowsout <= 300);
+        CHECK(stats.estimatedseconds > 0.0);
+    }
+
+    SECTION("Violins of empty groups are drawn without outlines")
+    {
+        const std::vector<double> empty;
+        const std::vector<double> nans = {NaN, NaN};
+        Plot2D plot;
+        plot.drawViolin(std::vector<std::vector<double>>{empty, nans, y});
+        plot.drawViolin(std::vector<std::vector<double>>{empty});
+        plot.drawCurve(x, y);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 3);
+        CHECK(draws[0].rowsin == 2 + n);
+        CHECK(draws[0].rowsout > 0);
+        CHECK(draws[1].rowsout == 0);
+
+        const auto script = plot.repr();
+        CHECK(script.find("index 2 with lines linestyle 3") != std::string::npos);
+        plot.savePlotData();
+        CHECK(datasetindices(script) == std::vector<std::size_t>{0, 1, 2});
+        plot.cleanup();
+    }
+
+    SECTION("Spectrograms fit the point budget and are written as binary files")
+    {
+        std::vector<double> signal(n);
+        for (auto i = 0; i < n; ++i)
+            signal[i] = std::sin(0.01 * i * (1.0 + i * 1e-5));
+
+        Plot2D plot;
+        plot.pointBudget(1000);
+        plot.drawSpectrogram(signal, 1000.0, 256, 128);
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.with == "image");
+        CHECK(stats.rowsout <= 1000);
+
+        const auto files = binaryfiles(plot.repr());
+        REQUIRE(files.size() == 1);
+        plot.savePlotData();
+        CHECK(filesize(files[0]) > 0);
+        plot.cleanup();
+    }
+
+    SECTION("Functions undefined everywhere keep the data sets after them in place")
+    {
+        Plot2D plot;
+        plot.drawFunction([](double) { return NaN; }, 0.0, 1.0);
+        plot.drawCurve(x, y);
+        CHECK(plot.renderStats().draws.front().rowsout == 0);
+
+        const auto script = plot.repr();
+        CHECK(script.find("index 1 with lines linestyle 2") != std::string::npos);
+        plot.savePlotData();
+        CHECK(datasetindices(script) == std::vector<std::size_t>{0, 1});
+        plot.cleanup();
+    }
+
+    SECTION("Contours without any crossing keep the data sets after them in place")
+    {
+        const std::vector<double> xs = {0.0, 1.0, 2.0};
+        const std::vector<double> ys = {0.0, 1.0};
+        const std::vector<std::vector<double>> zs = {{0.0, 1.0, 2.0}, {1.0, 2.0, 3.0}};
+        Plot2D plot;
+        plot.drawContours(xs, ys, zs, {10.0});
+        plot.drawCurve(xs, xs);
+        CHECK(plot.renderStats().draws.front().rowsout == 0);
+
+        const auto script = plot.repr();
+        CHECK(script.find("index 1 with lines linestyle 2") != std::string::npos);
+        plot.savePlotData();
+        CHECK(datasetindices(script) == std::vector<std::size_t>{0, 1});
+        plot.cleanup();
+    }
+
+    SECTION("The latency budget shrinks as draws are made")
+    {
+        Plot2D plot;
+        plot.latencyBudget(1.0);
+        plot.drawCurve(x, y);
+        plot.drawCurve(x, ydelta);
+        plot.drawCurve(y, x);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 3);
+        CHECK(draws[0].allowance > draws[1].allowance);
+        CHECK(draws[1].allowance >= draws[2].allowance);
+        auto spent = 0.0;
+        for (const auto& draw : draws)
+        {
+            CHECK(draw.rowsout <= draw.allowance);
+            spent += draw.estimatedseconds;
+        }
+        CHECK(spent <= 0.001 + 2 * internal::estimatedseconds(4));
+    }
+
+    SECTION("The plot script refers to every data set with consecutive line styles")
+    {
+        Plot2D plot;
+        plot.drawCurve(x, y);
+        plot.drawCurve(x, ydelta);
+        plot.drawBoxPlot(std::vector<std::vector<double>>{x, y});
+        plot.drawEnsemble(x, std::vector<std::vector<double>>{x, y, x});
+        plot.drawEnsembleRuns(x, std::vector<std::vector<double>>{x, y});
+        plot.drawECDF(x);
+        plot.drawViolin(std::vector<std::vector<double>>{x, y});
+        const auto script = plot.repr();
+        CHECK(script.find("index 0 with lines linestyle 1") != std::string::npos);
+        CHECK(script.find("index 1 with lines linestyle 2") != std::string::npos);
+        CHECK(script.find("index 2 using 1:4:3:7:6:2 with candlesticks whiskerbars linestyle 3") != std::string::npos);
+        CHECK(script.find("index 2 using 1:5:5:5:5:2 notitle with candlesticks linestyle 3") != std::string::npos);
+        // The line style of a draw is the position of its first plot element, shared by all elements of the draw
+        CHECK(script.find("index 3 using 1:2:6 notitle with filledcurves linestyle 5") != std::string::npos);
+        CHECK(script.find("index 3 using 1:4 with lines linestyle 5") != std::string::npos);
+        CHECK(script.find("index 4 using 1:2 with lines linestyle 8") != std::string::npos);
+        CHECK(script.find("index 5 with steps linestyle 9") != std::string::npos);
+        CHECK(script.find("index 6 using 1:2 with filledcurves closed linestyle 10") != std::string::npos);
+        CHECK(binaryfiles(script).empty());
+    }
+
+    SECTION("Images are pooled to the plot resolution only if requested")
+    {
+        std::vector<double> values(1000 * 600, 1.0);
+        const MatrixView image(values.data(), 600, 1000);
+
+        Plot2D plot;
+        plot.resolution(500, 300);
+        plot.drawImage(image, 0.0, 1.0, 0.0, 1.0);
+        plot.drawImage(image, 0.0, 1.0, 0.0, 1.0, Pooling::mean);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 2);
+        CHECK(draws[0].rowsout == 1000 * 600);
+        CHECK(draws[1].rowsout == 500 * 300);
+        CHECK(draws[0].estimatedseconds > draws[1].estimatedseconds);
+        CHECK(draws[1].estimatedseconds > 0.0);
+    }
+
+    SECTION("Images are placed with the full precision of their coordinates")
+    {
+        const std::vector<double> values(4, 1.0);
+        Plot2D plot;
+        plot.drawImage(MatrixView(values.data(), 2, 2), 1000000.0, 1000001.0, 0.0, 1.0);
+        const auto script = plot.repr();
+        CHECK(script.find("origin=(1000000.25,0.25) dx=0.5 dy=0.5") != std::string::npos);
+    }
+}
@@ -0,0 +1,168 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Plot3D.hpp>
+using namespace sciplot;
+
+TEST_CASE("Plot3D", "[plot3d]")
+{
+    const auto n = 400;
+    std::vector<double> z(n * n);
+    for (auto j = 0; j < n; ++j)
+        for (auto i = 0; i < n; ++i)
+            z[j * n + i] = std::sin(0.05 * i) * std::cos(0.03 * j);
+    const MatrixView view(z.data(), n, n);
+
+    SECTION("Surfaces are written whole without a budget")
+    {
+        Plot3D plot;
+        plot.drawSurface(view, 0.0, 1.0, 0.0, 1.0);
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.with == "pm3d");
+        CHECK(stats.rowsin == n * n);
+        CHECK(stats.rowsout == n * n);
+        CHECK(stats.allowance == 0);
+    }
+
+    SECTION("Surfaces and meshes are averaged down to the point budget and written as binary files")
+    {
+        Plot3D plot;
+        plot.pointBudget(2500);
+        plot.drawSurface(view, 0.0, 1.0, 0.0, 1.0);
+        plot.drawSurfaceMesh(view, 0.0, 1.0, 0.0, 1.0);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 2);
+        for (const auto& draw : draws)
+        {
+            CHECK(draw.rowsin == n * n);
+            CHECK(draw.rowsout == 50 * 50);
+            CHECK(draw.estimatedseconds > 0.0);
+        }
+
+        const auto script = plot.repr();
+        const auto first = script.find("-0.bin' binary matrix using 1:2:3 with pm3d linestyle 1");
+        const auto second = script.find("-1.bin' binary matrix using 1:2:3 with lines linestyle 2");
+        REQUIRE(first != std::string::npos);
+        REQUIRE(second != std::string::npos);
+        const auto begin = script.rfind('\'', first) + 1;
+        const auto filename = script.substr(begin, first + 6 - begin);
+
+        plot.savePlotData();
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        REQUIRE(file);
+        // A binary matrix holds a float for every node and one more for every row and column, giving its coordinates
+        CHECK(static_cast<std::size_t>(file.tellg()) == 51 * 51 * sizeof(float));
+        file.close();
+        plot.cleanup();
+    }
+
+    SECTION("Meshes are written as binary records with a scan line per triangle")
+    {
+        const std::vector<double> x = {0.0, 1.0, 0.0, 1.0};
+        const std::vector<double> y = {0.0, 0.0, 1.0, 1.0};
+        const std::vector<double> h = {0.0, 0.5, 0.5, 1.0};
+        Plot3D plot;
+        plot.drawMesh(x, y, h, {0, 1, 2, 1, 3, 2}, MeshDecimation::none());
+        const auto& stats = plot.renderStats().draws.back();
+        CHECK(stats.facesout == 2);
+        CHECK(stats.rowsout == 6);
+
+        const auto script = plot.repr();
+        const auto spec = script.find("-0.bin' binary record=(3,2) format='%float32%float32%float32' using 1:2:3 with polygons linestyle 1");
+        REQUIRE(spec != std::string::npos);
+        const auto begin = script.rfind('\'', spec) + 1;
+        const auto filename = script.substr(begin, spec + 6 - begin);
+
+        plot.savePlotData();
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        REQUIRE(file);
+        CHECK(static_cast<std::size_t>(file.tellg()) == 2 * 3 * 3 * sizeof(float));
+        file.close();
+        plot.cleanup();
+    }
+
+    SECTION("Meshes are drawn whole by default and must only refer to their vertices")
+    {
+        // A flat grid, which any screen-space error would simplify down to a couple of triangles
+        const std::size_t m = 20;
+        std::vector<double> x, y, h;
+        std::vector<std::size_t> triangles;
+        for (std::size_t j = 0; j < m; ++j)
+            for (std::size_t i = 0; i < m; ++i)
+                x.push_back(i), y.push_back(j), h.push_back(0.0);
+        for (std::size_t j = 0; j + 1 < m; ++j)
+            for (std::size_t i = 0; i + 1 < m; ++i)
+                triangles.insert(triangles.end(), {j * m + i, j * m + i + 1, (j + 1) * m + i, j * m + i + 1, (j + 1) * m + i + 1, (j + 1) * m + i});
+
+        Plot3D plot;
+        plot.drawMesh(x, y, h, triangles);
+        const auto stats = plot.renderStats().draws.back();
+        CHECK(stats.rowsin == m * m);
+        CHECK(stats.facesin == 2 * (m - 1) * (m - 1));
+        CHECK(stats.facesout == stats.facesin);
+
+        plot.drawMesh(x, y, h, triangles, MeshDecimation::pixels(0.5));
+        CHECK(plot.renderStats().draws.back().facesout < stats.facesin);
+
+        CHECK_THROWS_AS(plot.drawMesh(x, y, h, {0, 1, m * m}), std::invalid_argument);
+        CHECK_THROWS_AS(plot.drawMesh(x, y, h, {0, 1, 2, 3}), std::invalid_argument);
+    }
+
+    SECTION("Functions record their evaluations in the statistics of their draw")
+    {
+        Plot3D plot;
+        plot.drawFunction([](double x, double y) { return x * y; }, 0.0, 1.0, 0.0, 1.0, 30);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 1);
+        CHECK(draws[0].evaluations == 30 * 30);
+        CHECK(draws[0].rowsout == 30 * 30);
+    }
+
+    SECTION("Curves record their statistics")
+    {
+        const std::vector<double> x = {0.0, 1.0, 2.0};
+        Plot3D plot;
+        plot.drawCurve(x, x, x);
+        plot.drawPoints(x, x, x);
+        const auto& draws = plot.renderStats().draws;
+        REQUIRE(draws.size() == 2);
+        CHECK(draws[1].with == "points");
+        CHECK(plot.renderStats().rowsout() == 6);
+        const auto script = plot.repr();
+        CHECK(script.find("index 0 with lines linestyle 1") != std::string::npos);
+        CHECK(script.find("index 1 with points linestyle 2") != std::string::npos);
+    }
+}
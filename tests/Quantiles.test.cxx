@@ -0,0 +1,179 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Quantiles.hpp>
+using namespace sciplot;
+
+TEST_CASE("Quantiles", "[quantiles]")
+{
+    SECTION("quantiles are interpolated between the closest ranks")
+    {
+        std::vector<double> values = {9.0, 1.0, 8.0, 2.0, 7.0, 3.0, 6.0, 4.0, 5.0};
+        const auto quantiles = internal::selectquantiles(values, {0.0, 0.1, 0.5, 0.75, 1.0});
+        CHECK(quantiles[0] == 1.0);
+        CHECK(quantiles[1] == Approx(1.8));
+        CHECK(quantiles[2] == 5.0);
+        CHECK(quantiles[3] == 7.0);
+        CHECK(quantiles[4] == 9.0);
+    }
+
+    SECTION("box summary with outliers")
+    {
+        std::vector<double> values = {1.0, 2.0, 3.0, 4.0, 5.0, 100.0, -50.0, NaN};
+        const auto box = internal::boxsummary(values, 10);
+        CHECK(box.q1 == 1.5);
+        CHECK(box.median == 3.0);
+        CHECK(box.q3 == 4.5);
+        CHECK(box.whiskerlow == 1.0);
+        CHECK(box.whiskerhigh == 5.0);
+        CHECK(box.outliers == std::vector<double>{-50.0, 100.0});
+    }
+
+    SECTION("outliers are subsampled keeping the extremes")
+    {
+        CHECK(internal::capoutliers({5.0, 1.0, 3.0, 2.0, 4.0}, 3) == std::vector<double>{1.0, 3.0, 5.0});
+        CHECK(internal::capoutliers({5.0, 1.0}, 0).empty());
+    }
+
+    SECTION("summaries of several groups")
+    {
+        const std::vector<std::vector<double>> groups = {{1.0, 2.0, 3.0}, {}, {4.0}};
+        const auto boxes = internal::boxsummaries(groups, 10);
+        REQUIRE(boxes.size() == 3);
+        CHECK(boxes[0].median == 2.0);
+        CHECK(std::isnan(boxes[1].median));
+        CHECK(boxes[2].whiskerlow == 4.0);
+        CHECK(boxes[2].whiskerhigh == 4.0);
+    }
+}
+
+TEST_CASE("Quantile sketch", "[quantiles]")
+{
+    // A deterministic permutation of 0, 1, ..., n - 1, so that the exact quantile p is p * (n - 1)
+    const std::size_t n = 100000;
+    std::vector<double> samples(n);
+    for (std::size_t i = 0; i < n; ++i)
+        samples[i] = static_cast<double>((i * 7919) % n);
+
+    SECTION("quantiles are accurate, especially in the tails")
+    {
+        QuantileSketch sketch;
+        sketch.add(samples);
+        CHECK(sketch.count() == n);
+        CHECK(sketch.min() == 0.0);
+        CHECK(sketch.max() == n - 1.0);
+        CHECK(sketch.quantile(0.0) == 0.0);
+        CHECK(sketch.quantile(1.0) == n - 1.0);
+        CHECK(sketch.quantile(0.5) == Approx(0.5 * n).epsilon(0.01));
+        CHECK(sketch.quantile(0.25) == Approx(0.25 * n).epsilon(0.01));
+        CHECK(sketch.quantile(0.001) == Approx(0.001 * n).margin(0.0005 * n));
+        CHECK(sketch.quantile(0.999) == Approx(0.999 * n).margin(0.0005 * n));
+    }
+
+    SECTION("merged sketches agree with a single one")
+    {
+        QuantileSketch a;
+        QuantileSketch b;
+        for (std::size_t i = 0; i < n; ++i)
+            (i % 2 ? a : b).add(samples[i]);
+        a.merge(b);
+        CHECK(a.count() == n);
+        CHECK(a.quantile(0.5) == Approx(0.5 * n).epsilon(0.01));
+        CHECK(a.quantile(0.99) == Approx(0.99 * n).epsilon(0.01));
+    }
+
+    SECTION("box summary")
+    {
+        QuantileSketch sketch;
+        sketch.add(std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 100.0});
+        const auto box = sketch.boxSummary();
+        CHECK(box.median == Approx(3.5));
+        CHECK(box.outliers == std::vector<double>{100.0});
+        CHECK(std::isnan(QuantileSketch().quantile(0.5)));
+        CHECK_THROWS(QuantileSketch(1.0));
+    }
+}
+
+TEST_CASE("Ensemble percentiles", "[quantiles]")
+{
+    // Five runs of a hundred steps, where run r has value s + r at step s
+    const std::size_t numruns = 5;
+    const std::size_t numsteps = 100;
+    std::vector<double> rowmajor(numruns * numsteps);
+    std::vector<double> columnmajor(numruns * numsteps);
+    for (std::size_t r = 0; r < numruns; ++r)
+    {
+        for (std::size_t s = 0; s < numsteps; ++s)
+        {
+            rowmajor[r * numsteps + s] = s + r;
+            columnmajor[s * numruns + r] = s + r;
+        }
+    }
+    const std::vector<double> percentiles = {0.0, 25.0, 50.0, 100.0};
+    const auto byrows = internal::ensemblepercentiles(numruns, numsteps, true, [&](std::size_t r, std::size_t s) { return rowmajor[r * numsteps + s]; }, percentiles);
+    const auto bycolumns = internal::ensemblepercentiles(numruns, numsteps, false, [&](std::size_t r, std::size_t s) { return columnmajor[s * numruns + r]; }, percentiles);
+    REQUIRE(byrows.size() == 4);
+    CHECK(byrows == bycolumns);
+    for (std::size_t s = 0; s < numsteps; ++s)
+    {
+        CHECK(byrows[0][s] == s);
+        CHECK(byrows[1][s] == s + 1.0);
+        CHECK(byrows[2][s] == s + 2.0);
+        CHECK(byrows[3][s] == s + 4.0);
+    }
+}
+
+TEST_CASE("Empirical cumulative distribution", "[quantiles]")
+{
+    const std::vector<double> samples = {3.0, 1.0, 2.0, NaN, 2.0, 4.0};
+
+    SECTION("ecdf merges ties and skips missing values")
+    {
+        const auto [x, p] = internal::ecdf(samples, samples.size(), false);
+        CHECK(x == std::vector<double>{1.0, 2.0, 3.0, 4.0});
+        REQUIRE(p.size() == 4);
+        CHECK(p[0] == Approx(0.2));
+        CHECK(p[1] == Approx(0.6));
+        CHECK(p[2] == Approx(0.8));
+        CHECK(p[3] == Approx(1.0));
+    }
+
+    SECTION("complementary ecdf ends at 1/n")
+    {
+        const auto [x, p] = internal::ecdf(samples, samples.size(), true);
+        REQUIRE(p.size() == 4);
+        CHECK(p[0] == Approx(1.0));
+        CHECK(p[1] == Approx(0.8));
+        CHECK(p[2] == Approx(0.4));
+        CHECK(p[3] == Approx(0.2));
+    }
+}
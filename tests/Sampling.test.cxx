@@ -0,0 +1,125 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Sampling.hpp>
+using namespace sciplot;
+
+TEST_CASE("Sampling", "[sampling]")
+{
+    // Sample the given function for a plot of 640 x 480 pixels
+    const auto sample = [](auto f, double x0, double x1) {
+        internal::Evaluations evaluations;
+        return internal::adaptivesample(f, x0, x1, 640, 480, evaluations);
+    };
+
+    SECTION("straight lines need no subdivision")
+    {
+        const auto sampled = sample([](double x) { return 2.0 * x + 1.0; }, 0.0, 1.0);
+        CHECK(sampled.x.size() == internal::SAMPLING_INITIAL_INTERVALS + 1);
+        CHECK(sampled.blockends == std::vector<std::size_t>{sampled.x.size()});
+        CHECK(sampled.x.front() == 0.0);
+        CHECK(sampled.x.back() == 1.0);
+    }
+
+    SECTION("sharp features are refined within half a pixel")
+    {
+        const auto f = [](double x) { return std::exp(-x * x / 1e-4); };
+        internal::Evaluations evaluations;
+        const auto sampled = internal::adaptivesample(f, -1.0, 1.0, 640, 480, evaluations);
+        CHECK(evaluations.numevals < 2000);
+        CHECK(std::is_sorted(sampled.x.begin(), sampled.x.end()));
+        // The function at the middle of every segment stays within about a pixel of it (x spans 640 pixels, y 480)
+        for (std::size_t i = 0; i + 1 < sampled.x.size(); ++i)
+        {
+            const auto dx = (sampled.x[i + 1] - sampled.x[i]) * 320.0;
+            const auto dy = (sampled.y[i + 1] - sampled.y[i]) * 480.0;
+            const auto xm = 0.5 * (sampled.x[i] + sampled.x[i + 1]);
+            const auto ey = (f(xm) - sampled.y[i]) * 480.0;
+            CHECK(std::abs(dx * ey - dy * 0.5 * dx) < std::hypot(dx, dy));
+        }
+    }
+
+    SECTION("curves are broken at discontinuities and undefined values")
+    {
+        const auto step = sample([](double x) { return x < 0.3 ? 0.0 : 1.0; }, 0.0, 1.0);
+        REQUIRE(step.blockends.size() == 2);
+        const auto first = step.blockends[0];
+        CHECK(step.x[first - 1] == Approx(0.3).margin(1e-9));
+        CHECK(step.y[first - 1] == 0.0);
+        CHECK(step.y[first] == 1.0);
+
+        const auto root = sample([](double x) { return std::sqrt(x); }, -1.0, 1.0);
+        REQUIRE(root.blockends.size() == 1);
+        CHECK(root.x.front() == Approx(0.0).margin(1e-3));
+
+        // A steep but continuous function is not broken
+        const auto steep = sample([](double x) { return std::tanh(1000.0 * (x - 0.3)); }, 0.0, 1.0);
+        CHECK(steep.blockends.size() == 1);
+    }
+
+    SECTION("user executors give the same points as the default evaluation")
+    {
+        const auto f = [](double x) { return std::tan(x); };
+        internal::Evaluations byindex;
+        const auto expected = internal::adaptivesample(f, -3.0, 3.0, 640, 480, byindex);
+
+        // An executor running the tasks in reverse order, as a thread pool might
+        std::size_t numtasks = 0;
+        const Executor reverse = [&](std::size_t size, const std::function<void(std::size_t)>& task) {
+            for (auto i = size; i-- > 0;)
+                task(i);
+            numtasks += size;
+        };
+        internal::Evaluations evaluations(reverse);
+        const auto sampled = internal::adaptivesample(f, -3.0, 3.0, 640, 480, evaluations);
+        CHECK(sampled.x == expected.x);
+        CHECK(sampled.blockends == expected.blockends);
+        CHECK(evaluations.numevals == numtasks);
+        CHECK(evaluations.numevals == byindex.numevals);
+
+        DrawStats stats;
+        evaluations.record(stats);
+        CHECK(stats.evaluations == numtasks);
+        CHECK(stats.evaluationseconds >= 0.0);
+    }
+
+    SECTION("grids are evaluated row after row")
+    {
+        internal::Evaluations evaluations;
+        const auto values = internal::evaluategrid([](double x, double y) { return x + 10.0 * y; }, {1.0, 2.0, 3.0}, {0.0, 1.0}, evaluations);
+        CHECK(values == std::vector<double>{1.0, 2.0, 3.0, 11.0, 12.0, 13.0});
+        CHECK(evaluations.numevals == 6);
+    }
+}
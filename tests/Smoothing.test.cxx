@@ -0,0 +1,108 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Smoothing.hpp>
+using namespace sciplot;
+
+TEST_CASE("Smoothing", "[smoothing]")
+{
+    std::vector<double> y(500);
+    for (std::size_t i = 0; i < y.size(); ++i)
+        y[i] = static_cast<double>((i * 7919) % 101) + 0.01 * i;
+    y[10] = y[11] = y[12] = NaN;
+
+    const std::size_t window = 8;
+
+    // The sorted finite values of y in the centered window at i
+    const auto windowvalues = [&](std::size_t i) {
+        const auto first = i > (window - 1) / 2 ? i - (window - 1) / 2 : 0;
+        const auto last = std::min(i + window / 2 + 1, y.size());
+        std::vector<double> values;
+        for (auto j = first; j < last; ++j)
+            if (std::isfinite(y[j]))
+                values.push_back(y[j]);
+        std::sort(values.begin(), values.end());
+        return values;
+    };
+
+    SECTION("rolling windows match direct computation on any number of chunks")
+    {
+        for (std::size_t nthreads : {1, 3, 7})
+        {
+            const auto mean = Smoothing::mean(window).apply(y, y.size(), nthreads);
+            const auto median = Smoothing::median(window).apply(y, y.size(), nthreads);
+            const auto min = Smoothing::min(window).apply(y, y.size(), nthreads);
+            const auto max = Smoothing::max(window).apply(y, y.size(), nthreads);
+            REQUIRE(mean.size() == y.size());
+            for (std::size_t i = 0; i < y.size(); ++i)
+            {
+                const auto values = windowvalues(i);
+                const auto n = values.size();
+                double sum = 0.0;
+                for (auto v : values)
+                    sum += v;
+                CHECK(mean[i] == Approx(sum / n));
+                CHECK(median[i] == Approx(n % 2 ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2])));
+                CHECK(min[i] == values.front());
+                CHECK(max[i] == values.back());
+            }
+        }
+    }
+
+    SECTION("windows without finite values produce NaN")
+    {
+        const auto mean = Smoothing::mean(1).apply(y);
+        CHECK(std::isnan(mean[11]));
+        CHECK(mean[13] == Approx(y[13]));
+    }
+
+    SECTION("ewma with chunk halos matches the sequential average")
+    {
+        const auto sequential = Smoothing::ewma(0.2).apply(y, y.size(), 1);
+        const auto chunked = Smoothing::ewma(0.2).apply(y, y.size(), 5);
+        CHECK(sequential[0] == y[0]);
+        CHECK(sequential[1] == Approx(y[0] + 0.2 * (y[1] - y[0])));
+        CHECK(std::isnan(sequential[11]));
+        for (std::size_t i = 0; i < y.size(); ++i)
+            if (std::isfinite(y[i]))
+                CHECK(chunked[i] == Approx(sequential[i]).epsilon(1e-10));
+    }
+
+    SECTION("invalid parameters")
+    {
+        CHECK_THROWS_AS(Smoothing::mean(0), std::invalid_argument);
+        CHECK_THROWS_AS(Smoothing::ewma(0.0), std::invalid_argument);
+        CHECK_THROWS_AS(Smoothing::ewma(1.5), std::invalid_argument);
+    }
+}
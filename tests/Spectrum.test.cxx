@@ -0,0 +1,87 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Spectrum.hpp>
+using namespace sciplot;
+
+TEST_CASE("Spectrum", "[spectrum]")
+{
+    // A sine of amplitude 2 at 50 Hz sampled at 1 kHz
+    const auto fs = 1000.0;
+    std::vector<double> signal(8192);
+    for (std::size_t i = 0; i < signal.size(); ++i)
+        signal[i] = 2.0 * std::sin(2.0 * PI * 50.0 * i / fs);
+
+    SECTION("hann window")
+    {
+        const auto window = internal::hannwindow(4);
+        CHECK(window[0] == Approx(0.0).margin(1e-12));
+        CHECK(window[1] == Approx(0.5));
+        CHECK(window[2] == Approx(1.0));
+        CHECK(window[3] == Approx(0.5));
+    }
+
+    SECTION("welch estimate peaks at the frequency of the sine and integrates to its power")
+    {
+        const auto [frequencies, psd] = internal::powerspectrum(signal, signal.size(), fs, 1024);
+        REQUIRE(frequencies.size() == 513);
+        CHECK(frequencies.back() == Approx(500.0));
+        const auto peak = std::max_element(psd.begin(), psd.end()) - psd.begin();
+        CHECK(frequencies[peak] == Approx(50.0).margin(fs / 1024));
+        auto power = 0.0;
+        for (auto p : psd)
+            power += p * (frequencies[1] - frequencies[0]);
+        CHECK(power == Approx(2.0).epsilon(0.02)); // the mean square of the sine, A² / 2
+    }
+
+    SECTION("frames of a spectrogram")
+    {
+        const auto spectra = internal::framespectra(signal, signal.size(), fs, 256, 128);
+        CHECK(spectra.numframes == 1 + (8192 - 256) / 128);
+        REQUIRE(spectra.frequencies.size() == 129);
+        REQUIRE(spectra.power.size() == 129 * spectra.numframes);
+        // Every frame has its peak at the bin of 50 Hz (the 13th, at 50.8 Hz)
+        for (std::size_t f = 0; f < spectra.numframes; f += 10)
+        {
+            std::size_t peak = 0;
+            for (std::size_t k = 0; k < 129; ++k)
+                if (spectra.power[k * spectra.numframes + f] > spectra.power[peak * spectra.numframes + f])
+                    peak = k;
+            CHECK(peak == 13);
+        }
+        CHECK_THROWS_AS(internal::framespectra(signal, signal.size(), 0.0, 256, 128), std::invalid_argument);
+        CHECK(internal::framespectra(signal, 100, fs, 256, 128).numframes == 0);
+    }
+}
@@ -26,6 +26,11 @@
 // Catch includes
 #include <tests/catch.hpp>
 
+// C++ includes
+#include <cstring>
+#include <sstream>
+#include <vector>
+
 // sciplot includes
 #include <sciplot/Utils.hpp>
 using namespace sciplot;
@@ -42,3 +47,48 @@ TEST_CASE("plotting tests", "[plot]")
     CHECK(gnuplot::cleanpath("build:*?!\"<>|/xy.svg") == "build/xy.svg");
     CHECK(gnuplot::cleanpath("build:*?!\"<>|/xy:*?!\"<>|.svg") == "build/xy.svg");
 }
+
+TEST_CASE("binary matrix", "[plot]")
+{
+    const std::vector<double> x = {1.0, 2.0};
+    const std::vector<double> y = {10.0};
+    const std::vector<double> z = {3.0, 4.0};
+    const auto bytes = gnuplot::binarymatrix(x, y, z);
+    REQUIRE(bytes.size() == 6 * sizeof(float));
+    float values[6];
+    std::memcpy(values, bytes.data(), bytes.size());
+    CHECK(values[0] == 2.0f);
+    CHECK(values[1] == 1.0f);
+    CHECK(values[2] == 2.0f);
+    CHECK(values[3] == 10.0f);
+    CHECK(values[4] == 3.0f);
+    CHECK(values[5] == 4.0f);
+}
+
+TEST_CASE("binary array", "[plot]")
+{
+    // Two rows of two pixels with two channels each, written pixel after pixel
+    const auto bytes = gnuplot::binaryarrayof(2, 2, 2, [](std::size_t j, std::size_t i, std::size_t c) { return 100.0 * j + 10.0 * i + c; });
+    REQUIRE(bytes.size() == 8 * sizeof(float));
+    float values[8];
+    std::memcpy(values, bytes.data(), bytes.size());
+    CHECK(values[0] == 0.0f);
+    CHECK(values[1] == 1.0f);
+    CHECK(values[2] == 10.0f);
+    CHECK(values[3] == 11.0f);
+    CHECK(values[4] == 100.0f);
+    CHECK(values[7] == 111.0f);
+}
+
+TEST_CASE("block data sets", "[plot]")
+{
+    const std::vector<double> x = {1.0, 2.0, 3.0};
+    std::ostringstream blocks;
+    gnuplot::writeblockdataset(blocks, 0, {1, 3}, x);
+    CHECK(blocks.str().substr(blocks.str().find("1\n")) == "1\n\n2\n3\n\n\n");
+
+    // A data set without blocks still ends with two blank lines, so that the data sets after it keep their index
+    std::ostringstream empty;
+    gnuplot::writeblockdataset(empty, 0, {}, x);
+    CHECK(empty.str().substr(empty.str().rfind("=\n")) == "=\n\n\n");
+}
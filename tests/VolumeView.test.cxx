@@ -0,0 +1,56 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2022 Allan Leal, Bim Overbohm
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+
+// C++ includes
+#include <vector>
+
+// sciplot includes
+#include <sciplot/VolumeView.hpp>
+using namespace sciplot;
+
+TEST_CASE("VolumeView", "[volumeview]")
+{
+    // A 2 x 3 x 4 array stored layer after layer and row after row, with entry (k, j, i) equal to 100 k + 10 j + i
+    std::vector<double> values;
+    for (std::size_t k = 0; k < 2; ++k)
+        for (std::size_t j = 0; j < 3; ++j)
+            for (std::size_t i = 0; i < 4; ++i)
+                values.push_back(100.0 * k + 10.0 * j + i);
+
+    const VolumeView volume(values, 2, 3);
+    CHECK(volume.layers() == 2);
+    CHECK(volume.rows() == 3);
+    CHECK(volume.cols() == 4);
+    CHECK(volume(1, 2, 3) == 123.0);
+
+    // The same values seen with the order of the axes reversed through the strides
+    const VolumeView swapped(values.data(), 4, 3, 2, 1, 4, 12);
+    CHECK(swapped(3, 2, 1) == 123.0);
+    CHECK(swapped(1, 0, 0) == 1.0);
+}